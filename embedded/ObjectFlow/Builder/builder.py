@@ -4,12 +4,20 @@ from typing import TypedDict
 import yaml
 import glob
 from jsonpointer import resolve_pointer
-import copy
+import time
+
+# the libyaml parser and emitter are much faster on large flows, the pure Python ones are used if it isn't installed
+yamlLoader = getattr(yaml, "CSafeLoader", yaml.SafeLoader)
+yamlDumper = getattr(yaml, "CDumper", yaml.Dumper)
+
+def loadYaml(text):
+  return yaml.load(text, Loader = yamlLoader)
 
 class Graph():
 # class Graph(dict):
   def __init__(self, spec={}):
     self._graph = {}
+    self.timings = [] # (phase, seconds) of the build phases, reported by build()
     self.add(spec)
 
   def add(self, model):
@@ -54,6 +62,12 @@ class Graph():
   def graph(self):
     return self._graph
 
+  def _phaseDone(self, phase, start):
+    # record the wall time of a build phase that began at start, returns the start of the next phase
+    now = time.perf_counter()
+    self.timings.append( (phase, now - start) )
+    return now
+
   def resolve(self, pointer):
     return resolve_pointer(self._graph, pointer)
 
@@ -63,20 +77,23 @@ class Graph():
 
   def yaml(self):
     # options go here
-    return yaml.dump( self.graph() ) 
+    return yaml.dump( self.graph(), Dumper = yamlDumper ) 
 
 
 class ModelGraph(Graph):
   def __init__(self, modelPath):
     Graph.__init__(self)
+    start = time.perf_counter()
     # read in all of the SDF files in the model directory
     for file in glob.glob( modelPath + "*.sdf.json" ):
       print(file)
       self.add( json.loads( open(file,"r").read() ) )
     for file in glob.glob( modelPath + "*.sdf.yml" ):
       print(file)
-      self.add( yaml.safe_load( open(file,"r").read() ) )
+      self.add( loadYaml( open(file,"r").read() ) )
+    start = self._phaseDone("load models", start)
     self._checkPointers()
+    self._phaseDone("check pointers", start)
 
   # validate that all of the sdfRef and sdfRequired resolve to some place in the merged graph
   # recursive scan for instances of these keys and resolve the references
@@ -84,6 +101,7 @@ class ModelGraph(Graph):
   # 
   def _checkPointers(self):
     self._errors = 0
+    self._resolved = {} # each pointer is resolved once, True if it resolves
     self._check(self.graph())
 
   def _check(self, value):
@@ -102,11 +120,18 @@ class ModelGraph(Graph):
       self._pointer = self._pointer[2:]
     elif self._pointer.startswith("#"):
       self._pointer = self._pointer[1:]
+    if self._pointer in self._resolved: # already resolved, a broken pointer is still reported where it is used
+      if not self._resolved[self._pointer]:
+        print("sdfPointer doesn't resolve:", self._pointer)
+        self._errors += 1
+      return
+    self._resolved[self._pointer] = True
     if self._pointer.startswith("/"):
       try:
         target = self.resolve(self._pointer)
       except:
         print("sdfPointer doesn't resolve:", self._pointer)
+        self._resolved[self._pointer] = False
         self._errors += 1
         return
       return(target)
@@ -138,35 +163,87 @@ class ModelGraph(Graph):
     return yaml.dump(idList)
 
   def resourceHeader(self):
-  # return a C++ header fragment defining object type aliases
+  # return a C++ header fragment defining object type aliases, and the ResourceTraits of the resource types 
+  # that have one value type in the model, for Object::get<type>. The runtime's own types have theirs in objectflow.h
     resourceType = (self.resolve("/sdfData/TypeID/ResourceType"))
     resourceHeaderCode = "// Resource Types generated by ObjectFlow Builder\n"
     for type in resourceType:
       resourceHeaderCode += "#define %s %d\n" % (type, resourceType[type]["const"])
+    runtimeTypes = ["ValueType", "InputLink", "OutputLink", "InputValue", "CurrentValue", "OutputValue", "CurrentTime", "IntervalTime", 
+      "LastActivationTime", "Deadband", "Statistics"]
+    cppTypes = { "BooleanType": "bool", "IntegerType": "int", "FloatType": "double", "StringType": "StringValue", "TimeType": "time_t", 
+      "InstanceLinkType": "InstanceLink" }
+    valueTypes = self._resourceValueTypes()
+    resourceHeaderCode += "namespace ObjectFlow\n{\n"
+    for type in resourceType:
+      if type not in runtimeTypes and valueTypes.get(type) in cppTypes:
+        resourceHeaderCode += "  template <> struct ResourceTraits<%d> { typedef %s type; }; // %s\n" % (resourceType[type]["const"], 
+          cppTypes[valueTypes[type]], type)
+    resourceHeaderCode += "}\n"
     return resourceHeaderCode
 
+  def _resourceValueTypes(self):
+    # the value type of each resource type that has one, from the model sdfProperty definitions with an oma:id,
+    # reusable or in an sdfObject, and the definitions they refer to. A type used with two value types has none
+    def choices(resource):
+      valueType = resource.get("flo:meta", {}).get("ValueType", {})
+      if "sdfRef" in valueType and "/sdfChoice/" in valueType["sdfRef"]:
+        return [ valueType["sdfRef"].split("/")[-1] ]
+      if isinstance(valueType.get("sdfChoice"), dict):
+        return list(valueType["sdfChoice"])
+      if isinstance(resource.get("sdfChoice"), dict):
+        return list(resource["sdfChoice"])
+      if "sdfRef" in resource and resource["sdfRef"].startswith("/#/sdfProperty/"):
+        return choices(self.resolve(resource["sdfRef"][2:]))
+      return []
+
+    definitions = list(self.resolve("/sdfProperty").values())
+    for sdfObject in self.resolve("/sdfObject").values():
+      definitions += list(sdfObject.get("sdfProperty", {}).values())
+    valueTypes = {}
+    for resource in definitions:
+      if "oma:id" not in resource or "sdfRef" not in resource["oma:id"]:
+        continue
+      name = [ part for part in resource["oma:id"]["sdfRef"].split("/") if part not in ["", "#", "const"] ][-1]
+      resourceChoices = choices(resource)
+      valueType = resourceChoices[0] if len(resourceChoices) == 1 else None
+      valueTypes[name] = valueType if valueTypes.get(name, valueType) == valueType else None
+    return valueTypes
+
   def objectHeader(self):
     # construct the C++ code for mapping object TypeID to object type handler name in C++
     #    // Select an application Object based on its typeID
-    #    Object* ObjectList::applicationObject(uint16_t type, uint16_t instance, Object* firstObject) {
+    #    Object* ObjectListBase::applicationObject(uint16_t type, uint16_t instance, Object* firstObject) {
     #      switch (type) {
-    #        case 43000: return new TestObject(type, instance, firstObject);
-    #        default: return new Object(type, instance, firstObject);
+    #        case 43000: return new (arena) TestObject(type, instance, firstObject);
+    #        default: return new (arena) Object(type, instance, firstObject);
     #      }
     #    };
     # FIXME implement a way to do this with a struct in a header 
     # there should be separate source files for handlers
     objectHeaderCode = """// Generated by ObjectFlow builder
 // Select an application Object based on its typeID
-Object* ObjectList::applicationObject(uint16_t type, uint16_t instance, Object* firstObject) {
+Object* ObjectListBase::applicationObject(uint16_t type, uint16_t instance, Object* firstObject) {
   switch (type) {\n"""
     objectTypeList = self.resolve("/sdfData/TypeID/ObjectType")
     for objectTypeName in objectTypeList:
       objectTypeID = objectTypeList[objectTypeName]["const"]
-      objectHeaderCode += "    case %d: return new %s(type, instance, firstObject);\n" % (objectTypeID, objectTypeName)
-    objectHeaderCode += """    default: return new Object(type, instance, firstObject);
+      objectHeaderCode += "    case %d: return new (arena) %s(type, instance, firstObject);\n" % (objectTypeID, objectTypeName)
+    objectHeaderCode += """    default: return new (arena) Object(type, instance, firstObject);
   }
 };"""
+    # the handler calls of OBJECTFLOW_STATIC_DISPATCH, a switch with a direct call for each application class
+    handlers = [ ("void", "ValueUpdate", "uint16_t type, uint16_t instance, AnyValueType value", "type, instance, value"),
+      ("void", "ValuesUpdate", "Resource** resources, uint16_t count", "resources, count"), ("void", "Interval", "", ""),
+      ("void", "DefaultValueUpdate", "", ""), ("AnyValueType", "InputSync", "", "") ]
+    objectHeaderCode += "\n\n#ifdef OBJECTFLOW_STATIC_DISPATCH\n// Call the handlers of the application Object selected by its typeID, as applicationObject does\n"
+    for returnType, handler, parameters, arguments in handlers:
+      objectHeaderCode += "%s Object::call%s(%s) {\n  switch (typeID) {\n" % (returnType, handler, parameters)
+      for objectTypeName in objectTypeList:
+        objectHeaderCode += "    case %d: return static_cast<%s*>(this) -> on%s(%s);\n" % (objectTypeList[objectTypeName]["const"], objectTypeName, 
+          handler, arguments)
+      objectHeaderCode += "    default: return on%s(%s);\n  }\n};\n\n" % (handler, arguments)
+    objectHeaderCode += "#endif"
     return objectHeaderCode
 
 class FlowGraph(Graph):
@@ -202,6 +279,9 @@ class FlowGraph(Graph):
     # values, if "const" is defined
     #
     self._modelGraph = modelGraph
+    self._closures = {} # the refined closure of each sdfRef, see _closure
+    self._expandedObjects = {} # the expanded flow object of each type, see _expandObject
+    start = time.perf_counter()
 
     self._flowSpec = Graph() # for the JSON DSL spec, merge these also
 
@@ -210,9 +290,10 @@ class FlowGraph(Graph):
       self._flowSpec.add( json.loads( open(file,"r").read() ) )
     for file in glob.glob( flowPath + "*.flo.yml" ):
       print(file)
-      self._flowSpec.add( yaml.safe_load( open(file,"r").read() ) )
+      self._flowSpec.add( loadYaml( open(file,"r").read() ) )
 
     print(self._flowSpec.yaml())
+    self._phaseDone("load flow spec", start)
 
     self._resolveFlowGraph() 
 
@@ -224,19 +305,20 @@ class FlowGraph(Graph):
     self._flowBasePath = "/sdfThing/Flow/sdfObject"
     self._flowBase = self.resolve(self._flowBasePath)
     self._flowSpecBase = self._flowSpec.graph()["Flow"]
+    start = time.perf_counter()
+    expandTime = 0
 
     # for each object in the merged flow: 
     # add a named sdfObject with an sdfRef to the application object type, using a simple path reference
     # if there is no Type specified in the flow, the object name will be used as type
 
     for flowObject in self._flowSpecBase:
-      self._flowBase[flowObject] = {}
       if "$type" in self._flowSpecBase[flowObject]:
         # if $type is specified, use$type for sdfRef
-        self._flowBase[flowObject]["sdfRef"] = "/sdfObject/" + self._flowSpecBase[flowObject]["$type"]
+        objectRef = "/sdfObject/" + self._flowSpecBase[flowObject]["$type"]
       else:
         # if Type is not specified, use the name as sdfRef
-        self._flowBase[flowObject]["sdfRef"] = "/sdfObject/" + flowObject
+        objectRef = "/sdfObject/" + flowObject
 
       # Expand-Merge the named objects in the flow graph from corresponding objects in the model graph
       # Expands all of the Resources in the Model graph for each object, will not add resources that are not 
@@ -244,7 +326,9 @@ class FlowGraph(Graph):
       #
       print("Resolving ",flowObject)
       # expand all sdfRefs recursively
-      self._expandAll(self._flowBase[flowObject])
+      expandStart = time.perf_counter()
+      self._flowBase[flowObject] = self._expandObject(objectRef)
+      expandTime += time.perf_counter() - expandStart
  
       # Remove the unneeded resources and other noise from the flow template
     
@@ -292,6 +376,9 @@ class FlowGraph(Graph):
           else:
             print("non conforming value type for flow Object:", flowObject, ", Resource:", resource, ", Value:", self._flowSpecBase[flowObject][resource])
 
+    self.timings.append( ("expand sdfRefs", expandTime) )
+    start = self._phaseDone("prune and configure", start + expandTime)
+
     # assign instance IDs starting at 0, over-write any existing defaults or const 
     # FIXME allow for pre-defined instance numbers
 
@@ -306,16 +393,18 @@ class FlowGraph(Graph):
         self._flowBase[flowObject]["flo:meta"] = {}
       self._flowBase[flowObject]["flo:meta"]["TypeID"] = { "const": omaType }
       self._flowBase[flowObject]["flo:meta"]["InstanceID"] = { "const": instanceCount[omaType] }
-      # now do the resources
-      instanceCount = {}
+      # now do the resources, counted per object so the object instance counts go on to the next object
+      resourceCount = {}
       for resource in self._flowBase[flowObject]["sdfProperty"]:
         omaType = self._flowBase[flowObject]["sdfProperty"][resource]["oma:id"]["const"]
-        if omaType not in instanceCount:
-          instanceCount[omaType] = 0
+        if omaType not in resourceCount:
+          resourceCount[omaType] = 0
         else:
-          instanceCount[omaType] += 1
+          resourceCount[omaType] += 1
         self._flowBase[flowObject]["sdfProperty"][resource]["flo:meta"]["TypeID"] = { "const": omaType }
-        self._flowBase[flowObject]["sdfProperty"][resource]["flo:meta"]["InstanceID"] = { "const": instanceCount[omaType] }
+        self._flowBase[flowObject]["sdfProperty"][resource]["flo:meta"]["InstanceID"] = { "const": resourceCount[omaType] }
+
+    start = self._phaseDone("assign IDs", start)
 
     #   resolve oma objlinks from sdf object links
 
@@ -326,10 +415,20 @@ class FlowGraph(Graph):
           targetObject = self.resolve(objectPointer) # this is the flow graph (self) resolve
           self._flowBase[flowObject]["sdfProperty"][resource]["sdfChoice"]["InstanceLinkType"]["properties"]["TypeID"] = targetObject["flo:meta"]["TypeID"]
           self._flowBase[flowObject]["sdfProperty"][resource]["sdfChoice"]["InstanceLinkType"]["properties"]["InstanceID"] = targetObject["flo:meta"]["InstanceID"]
+    self._phaseDone("resolve links", start)
 
     # fini
 
 
+  # a flow object with an sdfRef to its type and all sdfRefs expanded. The expansion only depends on the type, 
+  # so it is made once for each type and each object gets a copy that the later steps can change
+  def _expandObject(self, objectRef):
+    if objectRef not in self._expandedObjects:
+      expanded = { "sdfRef": objectRef }
+      self._expandAll(expanded)
+      self._expandedObjects[objectRef] = expanded
+    return copyTree(self._expandedObjects[objectRef])
+
   # recursive expand-refine all dictionary nodes
   def _expandAll(self, value): 
     if isinstance(value, dict):
@@ -344,12 +443,51 @@ class FlowGraph(Graph):
       ref = value["sdfRef"]
       value.pop("sdfRef", None) # remove and replace with sdfRefFrom array to merge
       value["sdfRefFrom"] = [ref] # this will result in set merge of sdfRef strings for breadcrumbs
-       # expand all the way down the chain, making deep copies to merge into
-       # then mergeRefine in reverse order on the nested closure and return the fully resolved object
-      refined = self._mergeRefine(self._expandRefine(copy.deepcopy(self._resolveModel(ref))), value)
-      return refined
+      # refine the closure of the chain with the node, the closure is shared and is left unchanged
+      return self._refineShared(self._closure(ref), value)
     return value
 
+  # the closure of the chain of sdfRefs from ref, each model node refined by the next one back along the chain, 
+  # made once for each ref. Closures are shared by all the nodes that refer to them and by the closures that 
+  # refine them, so they and the model nodes in them must not be changed. _expandAll merges a copy into the flow
+  def _closure(self, ref):
+    if ref not in self._closures:
+      model = self._resolveModel(ref)
+      if isinstance(model, dict) and "sdfRef" in model:
+        patch = dict(model) # the model node with its sdfRef replaced, as _expandRefine does
+        patch.pop("sdfRef", None)
+        patch["sdfRefFrom"] = [model["sdfRef"]]
+        self._closures[ref] = self._refineShared(self._closure(model["sdfRef"]), patch)
+      else:
+        self._closures[ref] = model
+    return self._closures[ref]
+
+  # _mergeRefine into a new node instead of the base, which is left unchanged. The new node shares the subtrees 
+  # of the base that the patch doesn't refine, and has copies of the patch's subtrees
+  def _refineShared(self, base, patch):
+    if not isinstance( patch, dict):
+      return patch
+    refined = dict(base) if isinstance(base, dict) else {}
+    for key, patchItem in patch.items():
+      if isinstance(patchItem, dict):
+        baseValue = refined.get(key)
+        if isinstance(baseValue, dict) and "sdfChoice" != key: # sdfChoice is replaced as in _mergeRefine
+          refined[key] = self._refineShared(baseValue, patchItem)
+        else:
+          refined[key] = self._refineShared({}, patchItem)
+        continue
+      if isinstance(patchItem, list):
+        baseValue = refined.get(key)
+        if isinstance(baseValue, list):
+          refined[key] = list(set(baseValue + patchItem))
+          continue
+      if None is patchItem:
+        refined.pop(key, None)
+        continue
+      if "description" != key:
+        refined[key] = patchItem
+    return refined
+
   # special refine merge that handles array set merge and sdfChoice refinement. sdfChoice is refined by replacing
   # the entire sdfChoice with the patch value. If extension is desired, an sdfRef to the base sdfChoice contents
   # should be included in the patch. Descriptions are also filtered out as they are encountered, to reduce noise 
@@ -416,10 +554,49 @@ class FlowGraph(Graph):
   def objectFlowHeader(self):
     return self._header( self.resolve("/sdfThing/Flow/sdfObject") ) # convert the resolved instance graph to a header file
 
+  def objectFlowStaticHeader(self):
+    # convert the resolved instance graph to a statically initialized graph for OBJECTFLOW_STATIC_GRAPH builds
+    objectTypes = self._modelGraph.resolve("/sdfData/TypeID/ObjectType")
+    classNames = {}
+    for objectTypeName in objectTypes:
+      classNames[ objectTypes[objectTypeName]["const"] ] = objectTypeName
+    return staticInstancesHeader( self._instanceRows( self.resolve("/sdfThing/Flow/sdfObject") ), classNames, self._resourceTypeIDs() )
+
+  def objectFlowCompiledHeader(self):
+    # convert the resolved instance graph to straight-line flow code for OBJECTFLOW_COMPILED_FLOW builds
+    objectTypes = self._modelGraph.resolve("/sdfData/TypeID/ObjectType")
+    classNames = {}
+    for objectTypeName in objectTypes:
+      classNames[ objectTypes[objectTypeName]["const"] ] = objectTypeName
+    return compiledFlowHeader( self._instanceRows( self.resolve("/sdfThing/Flow/sdfObject") ), classNames, self._resourceTypeIDs() )
+
+  def objectFlowImage(self):
+    # convert the resolved instance graph to a binary flow image for ObjectList::loadImage
+    return flowImage( self._instanceRows( self.resolve("/sdfThing/Flow/sdfObject") ), self._resourceTypeIDs() )
+
+  def _resourceTypeIDs(self):
+    # type IDs of the link and value resources that the builder resolves
+    resourceTypes = self._modelGraph.resolve("/sdfData/TypeID/ResourceType")
+    resourceTypeIDs = {}
+    for resourceTypeName in ["InputLink", "OutputLink", "InputValue", "CurrentValue", "OutputValue", "Deadband", "CurrentTime", "IntervalTime", 
+      "LastActivationTime"]:
+      resourceTypeIDs[resourceTypeName] = resourceTypes[resourceTypeName]["const"]
+    return resourceTypeIDs
+
   def _header(self, Flow):
 
     headerString = "// Generated by ObjectFlow builder\nnamespace ObjectFlow\n{\n  const InstanceTemplate instanceList[] = {\n"
 
+    for row in self._instanceRows(Flow):
+      headerString += "    { %d, %d, %d, %d, %s, (AnyValueType){.%s = " % (row["oid"], row["oinst"], row["rid"], row["rinst"], row["type"], row["type"] ) 
+      headerString += row["value"] + " } },\n"
+
+    headerString +=   "  };\n}"
+    return headerString
+
+  def _instanceRows(self, Flow):
+    # one row per resource in instance list order, with the value type name and value formatted for C++
+    rows = []
     for flowObject in Flow:
       oid = Flow[flowObject]["flo:meta"]["TypeID"]["const"]
       oinst = Flow[flowObject]["flo:meta"]["InstanceID"]["const"]
@@ -440,6 +617,7 @@ class FlowGraph(Graph):
         else: 
           value = Flow[flowObject]["sdfProperty"][resource]["sdfChoice"][rtype]
 
+        link = None
         if rtype == "BooleanType":
           valueString = "%d" % value
         elif rtype == "IntegerType":
@@ -447,20 +625,19 @@ class FlowGraph(Graph):
         elif rtype == "FloatType":
           valueString = "%f" % value
         elif rtype == "StringType":
-          valueString = "%s" % value
+          valueString = "stringLiteral(%s)" % cString(value)
         elif rtype == "TimeType":
           valueString = "%d" % value
         elif rtype == "InstanceLinkType":
-          valueString = "{%d,%d}" % (value["properties"]["TypeID"]["const"], value["properties"]["InstanceID"]["const"])
+          link = (value["properties"]["TypeID"]["const"], value["properties"]["InstanceID"]["const"])
+          valueString = "{%d,%d}" % link
         else:
           print("Unimplemented resource type:", rtype)
           raise
 
-        headerString += "    { %d, %d, %d, %d, %s, (AnyValueType){.%s = " % (oid, oinst, rid, rinst, self._headerType(rtype), self._headerType(rtype) ) 
-        headerString += valueString + " } },\n"
-
-    headerString +=   "  };\n}"
-    return headerString
+        rows.append( { "oid": oid, "oinst": oinst, "rid": rid, "rinst": rinst, "type": self._headerType(rtype), "value": valueString, "link": link, 
+          "data": link if link is not None else value } )
+    return rows
 
   def _headerType(self, modelType):
     return self.modelGraph()["sdfData"]["ValueTypeString"]["sdfChoice"][modelType]["const"]
@@ -477,6 +654,417 @@ def _baseFlowTemplate():
     }
   )
 
+def copyTree(value):
+  # copy of the dicts and lists of a JSON tree, faster than copy.deepcopy
+  if isinstance(value, dict):
+    return { key: copyTree(item) for key, item in value.items() }
+  if isinstance(value, list):
+    return [ copyTree(item) for item in value ]
+  return value
+
+def cString(value):
+  # C string literal of a value, with the characters that a literal can't hold as octal escapes
+  text = ""
+  for byte in str(value).encode():
+    if byte in b'"\\?' or byte < 0x20 or byte > 0x7E:
+      text += "\\%03o" % byte
+    else:
+      text += chr(byte)
+  return '"' + text + '"'
+
+def groupObjects(rows):
+  # group the instance list rows by object, returns the object keys (type, instance) in order of first appearance
+  # and the rows of each object
+  objects = []
+  objectRows = {}
+  for row in rows:
+    key = (row["oid"], row["oinst"])
+    if key not in objectRows:
+      objects.append(key)
+      objectRows[key] = []
+    objectRows[key].append(row)
+  return objects, objectRows
+
+def flowSchedule(objects, objectRows, resourceTypeIDs):
+  # the flow schedule of ObjectList::buildSchedule, returns the object keys in schedule order, the partition 
+  # of each object and the (first, count) schedule range of each partition
+  position = { key: index for index, key in enumerate(objects) }
+
+  def linkedObjects(key, typeName):
+    return [ row["link"] for row in objectRows[key] if row["rid"] == resourceTypeIDs[typeName] and (typeName == "OutputLink" or row["rinst"] == 0) ]
+
+  # Kahn's algorithm as in buildSchedule, output targets in resource order then InputLink dependents in list order,
+  # and a cycle is broken at the first waiting object in list order
+  waiting = { key: 0 for key in objects }
+  pulls = { key: [] for key in objects }
+  for key in objects:
+    for target in linkedObjects(key, "OutputLink"):
+      if target in waiting:
+        waiting[target] += 1
+    for source in linkedObjects(key, "InputLink")[:1]:
+      if source in pulls:
+        waiting[key] += 1
+        pulls[source].append(key)
+  schedule = [ key for key in objects if waiting[key] == 0 ]
+  head = 0
+  while len(schedule) < len(objects):
+    while head < len(schedule):
+      key = schedule[head]
+      head += 1
+      for target in [ target for target in linkedObjects(key, "OutputLink") if target in waiting ] + pulls[key]:
+        if waiting[target] > 0:
+          waiting[target] -= 1
+          if waiting[target] == 0:
+            schedule.append(target)
+    for key in objects:
+      if waiting[key] > 0:
+        print("flow cycle at", list(key))
+        waiting[key] = 0
+        schedule.append(key)
+        break
+  # partitions are the weakly connected components, numbered in list order, and the schedule is grouped by partition
+  component = { key: key for key in objects }
+  def root(key):
+    while component[key] != key:
+      key = component[key]
+    return key
+  for key in objects:
+    for linked in linkedObjects(key, "OutputLink") + linkedObjects(key, "InputLink")[:1]:
+      if linked in component:
+        first, second = sorted([root(key), root(linked)], key = position.get)
+        component[second] = first
+  partitionOf = {}
+  partitionRoots = {}
+  for key in objects:
+    if root(key) not in partitionRoots:
+      partitionRoots[root(key)] = len(partitionRoots)
+    partitionOf[key] = partitionRoots[root(key)]
+  schedule = sorted(schedule, key = lambda key: partitionOf[key]) # stable
+  partitions = []
+  for index, key in enumerate(schedule):
+    if index == 0 or partitionOf[key] != partitionOf[schedule[index - 1]]:
+      partitions.append([index, 0])
+    partitions[-1][1] += 1
+  return schedule, partitionOf, [ tuple(partition) for partition in partitions ]
+
+def staticInstancesHeader(rows, classNames, resourceTypeIDs):
+  # construct the C++ code for a statically initialized object graph, an alternative to the instanceList
+  # table that needs no heap and no startup work. Each object is a global of its application class with 
+  # its resources in an array, and the object chain, default resources, links and the ObjectList hash index 
+  # and the packed resource keys are resolved here instead of by buildInstances, resolveLinks and indexResources,
+  # and the flow schedule is sorted here instead of by ObjectList::buildSchedule, in the same order
+  #
+  # rows are the instance list rows from _instanceRows, classNames maps object type IDs to application classes
+  # and resourceTypeIDs maps the link and value resource names to their type IDs
+  objects, objectRows = groupObjects(rows)
+
+  def objectName(key):
+    return "object_%d_%d" % key
+
+  def resourceName(key, position):
+    return "&resources_%d_%d[%d]" % (key[0], key[1], position)
+
+  def findResource(key, typeNames):
+    # first resource instance 0 of the types in priority order
+    for typeName in [ typeName for typeName in typeNames if typeName in resourceTypeIDs ]:
+      for position, row in enumerate(objectRows[key]):
+        if row["rid"] == resourceTypeIDs[typeName] and row["rinst"] == 0:
+          return resourceName(key, position)
+    return "NULL"
+
+  def className(key):
+    return classNames.get(key[0], "Object")
+
+  def linkTarget(key, row):
+    if row["link"] not in objectRows:
+      print("dangling link", list(key), [row["rid"], row["rinst"]], "=>", list(row["link"]))
+      raise Exception("dangling link in static graph")
+    return "&" + objectName(row["link"])
+
+  schedule, partitionOf, partitions = flowSchedule(objects, objectRows, resourceTypeIDs)
+  scheduleIndex = { key: position for position, key in enumerate(schedule) }
+
+  headerString = "// Generated by ObjectFlow builder\n// Statically initialized object graph, build with OBJECTFLOW_STATIC_GRAPH\nnamespace ObjectFlow\n{\n"
+  for key in objects:
+    headerString += "  extern %s %s;\n" % (className(key), objectName(key))
+
+  for index, key in enumerate(objects):
+    resources = objectRows[key]
+    headerString += "\n  // [%d, %d]\n" % key
+    # string values point to their literal, aligned so that it isn't taken for an inline string
+    for position, row in enumerate(resources):
+      if row["type"] == "stringType":
+        headerString += "  alignas(2) const char string_%d_%d_%d[] = %s;\n" % (key[0], key[1], position, cString(row["data"]))
+    headerString += "  Resource resources_%d_%d[%d] = {\n" % (key[0], key[1], len(resources))
+    for position, row in enumerate(resources):
+      nextResource = resourceName(key, position + 1) if position + 1 < len(resources) else "NULL"
+      value = "stringLiteral(string_%d_%d_%d)" % (key[0], key[1], position) if row["type"] == "stringType" else row["value"]
+      headerString += "    Resource(%d, %d, %s, AnyValueType{ .%s = %s }, %s),\n" % (row["rid"], row["rinst"], row["type"], row["type"], value, nextResource)
+    headerString += "  };\n"
+    headerString += "  uint32_t keys_%d_%d[%d] = { %s };\n" % (key[0], key[1], len(resources), 
+      ", ".join( "%du" % ((row["rid"] << 16) | row["rinst"]) for row in resources ))
+    headerString += "  Resource* table_%d_%d[%d] = { %s };\n" % (key[0], key[1], len(resources), 
+      ", ".join( resourceName(key, position) for position in range(len(resources)) ))
+
+    inputObject = "NULL"
+    outputs = []
+    for row in resources:
+      if row["rid"] == resourceTypeIDs["InputLink"] and row["rinst"] == 0:
+        inputObject = linkTarget(key, row)
+      if row["rid"] == resourceTypeIDs["OutputLink"]:
+        outputs.append(linkTarget(key, row))
+    outputObjects = "NULL"
+    if len(outputs) > 0:
+      outputObjects = "outputs_%d_%d" % key
+      headerString += "  Object* %s[] = { %s };\n" % (outputObjects, ", ".join(outputs))
+
+    nextObject = "&" + objectName(objects[index + 1]) if index + 1 < len(objects) else "NULL"
+    headerString += "  %s %s({ %d, %d, %s, &%s, %s, %s, &staticObjectList,\n" % (className(key), objectName(key), key[0], key[1], 
+      nextObject, objectName(objects[0]), resourceName(key, 0), resourceName(key, len(resources) - 1) )
+    headerString += "    %s, %s, %s, %s, %d, keys_%d_%d, table_%d_%d, %d, %d, %d, %s });\n" % ( findResource(key, ["OutputValue", "CurrentValue", "InputValue"]), 
+      findResource(key, ["InputValue", "CurrentValue", "OutputValue"]), inputObject, outputObjects, len(outputs), key[0], key[1], key[0], key[1], len(resources),
+      scheduleIndex[key], partitionOf[key], findResource(key, ["Deadband"]) )
+
+  # hash index with the same key, hash and linear probing as ObjectList::indexObject, load factor at most 1/2
+  indexSize = 8
+  while len(objects) * 2 > indexSize:
+    indexSize *= 2
+  index = [None] * indexSize
+  for key in objects:
+    indexKey = (key[0] << 16) | key[1]
+    hash = (indexKey * 2654435761) & 0xFFFFFFFF
+    slot = (hash ^ (hash >> 16)) & (indexSize - 1)
+    while index[slot] is not None:
+      slot = (slot + 1) & (indexSize - 1)
+    index[slot] = key
+  headerString += "\n  ObjectIndexEntry staticIndex[%d] = {\n" % indexSize
+  for key in index:
+    if key is None:
+      headerString += "    { 0, NULL },\n"
+    else:
+      headerString += "    { %du, &%s },\n" % ((key[0] << 16) | key[1], objectName(key))
+  headerString += "  };\n\n"
+  headerString += "  Object* staticSchedule[%d] = { %s };\n" % (len(schedule), ", ".join( "&" + objectName(key) for key in schedule ))
+  headerString += "  FlowPartition staticPartitions[%d] = { %s };\n\n" % (len(partitions), 
+    ", ".join( "{ %d, %d, %d, %d, false }" % (first, count, first + count, first) for first, count in partitions ))
+  headerString += "  ObjectListBase staticObjectList(&%s, &%s, staticIndex, %d, %d, staticSchedule, staticPartitions, %d);\n}" % (objectName(objects[0]), 
+    objectName(objects[-1]), indexSize, len(objects), len(partitions))
+  return headerString
+
+def compiledFlowHeader(rows, classNames, resourceTypeIDs):
+  # construct the C++ code of a compiled flow for each trigger, an Object with a CurrentTime, an IntervalTime 
+  # other than 0 and a LastActivationTime. Its run method does what updateTimers and runFlow would do when the 
+  # trigger is due, in straight-line code: the handler of each Object downstream of the trigger through its 
+  # OutputLinks is called directly in schedule order, and when the handler calls syncToOutputLink the default 
+  # values are copied between resources bound once by bind, instead of syncToOutputLink walking the links. 
+  # Links back to an Object that has already run, around a cycle, update the value and mark the Object dirty for
+  # runFlow, as a scheduled flow would
+  #
+  # rows are the instance list rows from _instanceRows, classNames maps object type IDs to application classes
+  # and resourceTypeIDs maps the link, value and timer resource names to their type IDs
+  objects, objectRows = groupObjects(rows)
+  schedule, partitionOf, partitions = flowSchedule(objects, objectRows, resourceTypeIDs)
+  scheduleIndex = { key: position for position, key in enumerate(schedule) }
+
+  def findRow(key, typeNames):
+    # first resource instance 0 of the types in priority order
+    for typeName in [ typeName for typeName in typeNames if typeName in resourceTypeIDs ]:
+      for row in objectRows[key]:
+        if row["rid"] == resourceTypeIDs[typeName] and row["rinst"] == 0:
+          return row
+    return None
+
+  def suffix(key):
+    return "%d_%d" % key
+
+  def className(key):
+    return classNames.get(key[0], "Object")
+
+  def outputTargets(key):
+    targets = []
+    for row in objectRows[key]:
+      if row["rid"] == resourceTypeIDs["OutputLink"]:
+        if row["link"] not in objectRows:
+          print("dangling link", list(key), [row["rid"], row["rinst"]], "=>", list(row["link"]))
+          continue
+        targets.append(row["link"])
+    return targets
+
+  def comparable(key, destination):
+    # the change test of updateDefaultValue is a compare of the value unless the deadband, a float or a string 
+    # needs valueChanged
+    return findRow(key, ["Deadband"]) is None and destination["type"] in ["booleanType", "integerType", "timeType"]
+
+  def changed(key, destination):
+    if comparable(key, destination):
+      return "destination_%s -> getValue().%s != value.%s" % (suffix(key), destination["type"], destination["type"])
+    return "object_%s -> valueChanged(destination_%s, value)" % (suffix(key), suffix(key))
+
+  triggers = [ key for key in objects if None not in [ findRow(key, [typeName]) for typeName in ["CurrentTime", "IntervalTime", "LastActivationTime"] ] 
+    and findRow(key, ["IntervalTime"])["data"] != 0 ]
+
+  headerString = "// Generated by ObjectFlow builder\n// Compiled flows, build with OBJECTFLOW_COMPILED_FLOW\nnamespace ObjectFlow\n{\n"
+  for trigger in triggers:
+    # the Objects downstream of the trigger in schedule order
+    reached = [trigger]
+    reachedSet = { trigger }
+    for key in reached:
+      for target in outputTargets(key):
+        if target not in reachedSet:
+          reached.append(target)
+          reachedSet.add(target)
+    path = sorted(reached, key = scheduleIndex.get)
+    path.remove(trigger)
+    path.insert(0, trigger)
+    sources = { key: findRow(key, ["OutputValue", "CurrentValue", "InputValue"]) for key in path }
+    destinations = { key: findRow(key, ["InputValue", "CurrentValue", "OutputValue"]) for key in path }
+    position = { key: index for index, key in enumerate(path) }
+
+    flowName = "CompiledFlow_" + suffix(trigger)
+    headerString += "  // [%d, %d] interval => %s\n" % (trigger[0], trigger[1], " => ".join( "[%d, %d]" % key for key in path[1:] ) if len(path) > 1 else "no outputs")
+    headerString += "  class %s {\n    public:\n      ObjectListBase* list;\n" % flowName
+    for key in path:
+      headerString += "      %s* object_%s;\n" % (className(key), suffix(key))
+    headerString += "      Resource* currentTime;\n      Resource* intervalTime;\n      Resource* lastActivationTime;\n"
+    for key in path:
+      if sources[key] is not None and len(outputTargets(key)) > 0:
+        headerString += "      Resource* source_%s;\n" % suffix(key)
+      if destinations[key] is not None and key != trigger:
+        headerString += "      Resource* destination_%s;\n" % suffix(key)
+
+    # bind
+    headerString += "\n      // resolve the Objects and Resources of the flow in an ObjectList, returns false if one is missing\n"
+    headerString += "      bool bind(ObjectListBase* flowList) {\n        list = flowList;\n"
+    for key in path:
+      headerString += "        object_%s = static_cast<%s*>(list -> getObjectByID(%d, %d));\n" % (suffix(key), className(key), key[0], key[1])
+    headerString += "        if (%s) {\n          printf(\"%s can't bind the Objects\\n\");\n          return false;\n        }\n" % (
+      " || ".join( "NULL == object_%s" % suffix(key) for key in path ), flowName)
+    resources = []
+    for name, typeName in [ ("currentTime", "CurrentTime"), ("intervalTime", "IntervalTime"), ("lastActivationTime", "LastActivationTime") ]:
+      resources.append(name)
+      headerString += "        %s = object_%s -> getResourceByID(%d, 0);\n" % (name, suffix(trigger), resourceTypeIDs[typeName])
+    for key in path:
+      if sources[key] is not None and len(outputTargets(key)) > 0:
+        resources.append("source_" + suffix(key))
+        headerString += "        source_%s = object_%s -> getResourceByID(%d, 0);\n" % (suffix(key), suffix(key), sources[key]["rid"])
+      if destinations[key] is not None and key != trigger:
+        resources.append("destination_" + suffix(key))
+        headerString += "        destination_%s = object_%s -> getResourceByID(%d, 0);\n" % (suffix(key), suffix(key), destinations[key]["rid"])
+        if not comparable(key, destinations[key]):
+          headerString += "        object_%s -> resolveDefaults(); // the deadband for valueChanged\n" % suffix(key)
+    headerString += "        if (%s) {\n          printf(\"%s can't bind the Resources\\n\");\n          return false;\n        }\n        return true;\n      };\n" % (
+      " || ".join( "NULL == " + name for name in resources ), flowName)
+
+    # run
+    headerString += "\n      // run the flow if [%d, %d] is due at the time, as updateTimers and runFlow would, returns the number of Objects run\n" % trigger
+    headerString += "      uint32_t run(time_t timeValue) {\n"
+    headerString += "        currentTime -> set<time_t>(timeValue);\n"
+    headerString += "        if (timeValue - lastActivationTime -> get<time_t>() < intervalTime -> get<time_t>()) {\n          return 0;\n        }\n"
+    headerString += "        lastActivationTime -> set<time_t>(timeValue);\n"
+    headerString += "        if (object_%s -> timerIndex != noTimer) {\n          list -> rescheduleTimer(object_%s);\n        }\n" % (suffix(trigger), suffix(trigger))
+    headerString += "        list -> linksCompiled = true; // the handlers' syncToOutputLink sets synced, the values are copied here\n"
+    headerString += "        uint32_t run = 1;\n        AnyValueType value;\n"
+    for key in path[1:]:
+      headerString += "        bool updated_%s = false;\n" % suffix(key)
+    for key in path:
+      indent = "        "
+      copies = [ target for target in outputTargets(key) if destinations[target] is not None ] if sources[key] is not None else []
+      if key != trigger:
+        headerString += "        if (updated_%s) {\n" % suffix(key)
+        indent = "          "
+      if len(copies) > 0:
+        headerString += "%sobject_%s -> synced = false;\n" % (indent, suffix(key))
+      headerString += "%sobject_%s -> %s::%s();\n" % (indent, suffix(key), className(key), "onInterval" if key == trigger else "onDefaultValueUpdate")
+      if key != trigger:
+        headerString += "%srun++;\n" % indent
+      if len(copies) > 0:
+        headerString += "%sif (object_%s -> synced) { // the handler propagates its value\n" % (indent, suffix(key))
+        for target in copies:
+          copyIndent = indent + "  "
+          headerString += "%s// [%d, %d] => [%d, %d]\n" % (copyIndent, key[0], key[1], target[0], target[1])
+          headerString += "%svalue = source_%s -> getValue();\n" % (copyIndent, suffix(key))
+          headerString += "%sif (%s) {\n%s  destination_%s -> setValue(value);\n" % (copyIndent, changed(target, destinations[target]), copyIndent, suffix(target))
+          if position[target] > position[key]:
+            headerString += "%s  updated_%s = true;\n" % (copyIndent, suffix(target))
+          else:
+            headerString += "%s  list -> markDirty(object_%s); // around a cycle\n" % (copyIndent, suffix(target))
+          headerString += "%s}\n%selse {\n%s  object_%s -> suppressedCount++;\n%s}\n" % (copyIndent, copyIndent, copyIndent, suffix(target), copyIndent)
+        headerString += "%s}\n" % indent
+      if key != trigger:
+        headerString += "        }\n"
+    headerString += "        list -> linksCompiled = false;\n        return run;\n      };\n  };\n\n"
+  headerString += "}"
+  return headerString
+
+def flowImage(rows, resourceTypeIDs):
+  # construct the binary flow image for ObjectList::loadImage, the layout is in flowimage.h. It holds the 
+  # same flow as the instanceList table, with the links, schedule and partitions resolved as for the static 
+  # graph. Dangling links are reported and left out, as ObjectList::resolveLinks does
+  #
+  # rows are the instance list rows from _instanceRows, with the raw value of each row in "data"
+  import struct
+  valueTypes = ["booleanType", "integerType", "floatType", "stringType", "linkType", "timeType"] # enum ValueType
+  valueFormats = ["<?7x", "<i4x", "<d", "<Q", "<HH4x", "<I4x"]
+  none = 0xFFFFFFFF
+
+  objects, objectRows = groupObjects(rows)
+  schedule, partitionOf, partitions = flowSchedule(objects, objectRows, resourceTypeIDs)
+  scheduleIndex = { key: position for position, key in enumerate(schedule) }
+  objectIndex = { key: position for position, key in enumerate(objects) }
+
+  def linkTarget(key, row):
+    if row["link"] not in objectIndex:
+      print("dangling link", list(key), [row["rid"], row["rinst"]], "=>", list(row["link"]))
+      return None
+    return objectIndex[row["link"]]
+
+  objectRecords = []
+  resourceRecords = []
+  keys = []
+  outputs = []
+  pool = bytearray()
+  for key in objects:
+    inputObject = none
+    firstResource = len(keys)
+    firstOutput = len(outputs)
+    for row in objectRows[key]:
+      valueType = valueTypes.index(row["type"])
+      value = row["data"]
+      if row["type"] == "stringType":
+        value = len(pool)
+        pool += str(row["data"]).encode() + b"\0"
+      elif row["type"] == "linkType":
+        target = linkTarget(key, row) if row["rid"] in [resourceTypeIDs["InputLink"], resourceTypeIDs["OutputLink"]] else None
+        if target is not None and row["rid"] == resourceTypeIDs["OutputLink"]:
+          outputs.append(target)
+        elif target is not None and row["rinst"] == 0:
+          inputObject = target
+      resourceRecords.append(struct.pack("<HHI", row["rid"], row["rinst"], valueType) + struct.pack(valueFormats[valueType], *(value if row["type"] == "linkType" else (value,))))
+      keys.append((row["rid"] << 16) | row["rinst"])
+    objectRecords.append(struct.pack("<HHIIIIIHHI", key[0], key[1], firstResource, firstOutput, inputObject, scheduleIndex[key], partitionOf[key], 
+      len(keys) - firstResource, len(outputs) - firstOutput, 0))
+
+  def align(offset):
+    return (offset + 7) & ~7
+  objectsOffset = 64
+  resourcesOffset = align(objectsOffset + 32 * len(objectRecords))
+  keysOffset = align(resourcesOffset + 16 * len(resourceRecords))
+  outputsOffset = align(keysOffset + 4 * len(keys))
+  partitionsOffset = align(outputsOffset + 4 * len(outputs))
+  poolOffset = align(partitionsOffset + 8 * len(partitions))
+  imageSize = poolOffset + len(pool)
+
+  image = bytearray(imageSize)
+  image[0:64] = struct.pack("<IHHIIIIIIIIIIIIII", 0x574C464F, 1, 64, 0x01020304, imageSize, len(objectRecords), len(resourceRecords), len(outputs), 
+    len(partitions), len(pool), objectsOffset, resourcesOffset, keysOffset, outputsOffset, partitionsOffset, poolOffset, 0)
+  image[objectsOffset:resourcesOffset] = b"".join(objectRecords).ljust(resourcesOffset - objectsOffset, b"\0")
+  image[resourcesOffset:keysOffset] = b"".join(resourceRecords).ljust(keysOffset - resourcesOffset, b"\0")
+  image[keysOffset:outputsOffset] = struct.pack("<%dI" % len(keys), *keys).ljust(outputsOffset - keysOffset, b"\0")
+  image[outputsOffset:partitionsOffset] = struct.pack("<%dI" % len(outputs), *outputs).ljust(partitionsOffset - outputsOffset, b"\0")
+  image[partitionsOffset:poolOffset] = struct.pack("<%dI" % (2 * len(partitions)), *[ field for partition in partitions for field in partition ]).ljust(poolOffset - partitionsOffset, b"\0")
+  image[poolOffset:] = pool
+  return bytes(image)
+
 def build():
   import sys
   print("FlowBuilder")
@@ -487,14 +1075,31 @@ def build():
     sys.exit(1)
 
   # print(model.json())
+  timings = []
+  start = time.perf_counter()
   print (model.idList())
   print ( model.objectHeader() )
   print ( model.resourceHeader() )
+  timings.append( ("model headers", time.perf_counter() - start) )
 
   flow = FlowGraph( model, "../Flow/" )
   # print (flow.json())
 
-  print ( flow.objectFlowHeader() )
+  for phase, output in [ ("flow header", flow.objectFlowHeader), ("static header", flow.objectFlowStaticHeader), 
+    ("compiled header", flow.objectFlowCompiledHeader) ]:
+    start = time.perf_counter()
+    print ( output() )
+    timings.append( (phase, time.perf_counter() - start) )
+
+  if len(sys.argv) > 1: # builder.py image-file writes the binary flow image for ObjectList::loadImage
+    start = time.perf_counter()
+    with open(sys.argv[1], "wb") as imageFile:
+      imageFile.write( flow.objectFlowImage() )
+    timings.append( ("flow image", time.perf_counter() - start) )
+
+  # the time of each build phase, on stderr so the generated code on stdout is the same on every build
+  for phase, seconds in model.timings + flow.timings + timings:
+    print("%-20s %8.3f s" % (phase, seconds), file=sys.stderr)
 
 if __name__ == '__main__':
     build()
@@ -0,0 +1,87 @@
+/* arena is a block allocator for the nodes of an ObjectList */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "arena.h"
+
+using namespace ObjectFlow;
+
+// allocations are aligned for the largest member of a node, a double or a pointer
+static const size_t arenaAlignment = (sizeof(double) > sizeof(void*) ? sizeof(double) : sizeof(void*));
+
+static inline size_t alignedSize(size_t size) {
+  return (size + arenaAlignment - 1) & ~(arenaAlignment - 1);
+};
+
+static const size_t blockHeaderSize = (sizeof(ArenaBlock) + arenaAlignment - 1) & ~(arenaAlignment - 1);
+
+Arena::~Arena() {
+  release();
+};
+
+// make sure the next size bytes can be allocated from one block
+// with a block size of 0 there is nothing to reserve, every allocation gets its own block
+void ArenaBase::reserve(size_t size) {
+  size = alignedSize(size);
+  if (0 == blockSize || (firstBlock != NULL && firstBlock -> size - firstBlock -> used >= size)) {
+    return;
+  }
+  newBlock(size);
+};
+
+// add a block with room for at least size bytes, the space left in the current block is not used again
+bool ArenaBase::newBlock(size_t size) {
+  size_t storage = (size > blockSize ? size : blockSize);
+  ArenaBlock* block = (ArenaBlock*)malloc(blockHeaderSize + storage);
+  if (NULL == block) {
+    printf("Arena couldn't allocate a block of %u bytes\n", (unsigned)storage);
+    return false;
+  }
+  block -> size = storage;
+  block -> used = 0;
+  block -> nextBlock = firstBlock;
+  firstBlock = block;
+  bytesReserved += storage;
+  blockCount++;
+  return true;
+};
+
+// return size bytes of storage aligned for any node type
+void* ArenaBase::allocate(size_t size) {
+  size = alignedSize(size);
+  if (NULL == firstBlock || firstBlock -> size - firstBlock -> used < size) {
+    if (!newBlock(size)) {
+      return NULL;
+    }
+  }
+  void* pointer = (char*)firstBlock + blockHeaderSize + firstBlock -> used;
+  firstBlock -> used += size;
+  bytesUsed += size;
+  allocationCount++;
+  return pointer;
+};
+
+// free all blocks and everything allocated from them, without running destructors
+void ArenaBase::release() {
+  while (firstBlock != NULL) {
+    ArenaBlock* block = firstBlock;
+    firstBlock = block -> nextBlock;
+    free(block);
+  };
+  bytesUsed = 0;
+  bytesReserved = 0;
+  allocationCount = 0;
+  blockCount = 0;
+};
+
+void* operator new(size_t size, ObjectFlow::ArenaBase& arena) noexcept {
+  return arena.allocate(size);
+};
+
+void operator delete(void* pointer, ObjectFlow::ArenaBase& arena) {};
+
+void* operator new[](size_t size, ObjectFlow::ArenaBase& arena) noexcept {
+  return arena.allocate(size);
+};
+
+void operator delete[](void* pointer, ObjectFlow::ArenaBase& arena) {};
@@ -0,0 +1,69 @@
+/* arena is a block allocator for the nodes of an ObjectList */
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ObjectFlow
+
+{
+  /* 
+  Objects and Resources of an ObjectList are allocated from its Arena. Nodes are placed one after 
+  another in large blocks, so the graph is contiguous in memory, costs one malloc per block instead 
+  of one per node, and the whole graph is freed in one operation by release(). Nodes are never freed
+  individually. A block size of 0 makes every allocation its own block, the same pattern as a new per node. 
+  release() doesn't run destructors, so node types, application Object subclasses included, must be trivially
+  destructible: members that own heap memory or other resources aren't freed with the arena.
+  */
+
+  // header of a block of arena storage, the storage follows the header
+  struct ArenaBlock {
+    ArenaBlock* nextBlock;
+    size_t size; // bytes of storage in the block
+    size_t used; // bytes allocated from the block
+  };
+
+  // the allocator without a destructor, the blocks are freed by release(). Static storage of this type needs no 
+  // exit handler, it's the arena of ObjectListBase and of the static graph, Arena frees the blocks when destroyed
+  class ArenaBase {
+    public:
+      // construct an empty arena that grows in blocks of at least blockSize bytes
+      constexpr ArenaBase(size_t minimumBlockSize = 1024) : 
+        firstBlock(NULL), blockSize(minimumBlockSize), bytesUsed(0), bytesReserved(0), allocationCount(0), blockCount(0) {};
+
+      ArenaBlock* firstBlock; // block that allocations are made from, chained to the older blocks
+      size_t blockSize;
+
+      // statistics
+      size_t bytesUsed; // bytes allocated including alignment padding
+      size_t bytesReserved; // bytes of block storage
+      uint32_t allocationCount;
+      uint32_t blockCount;
+
+      // make sure the next size bytes can be allocated from one block
+      void reserve(size_t size);
+
+      // add a block with room for at least size bytes
+      bool newBlock(size_t size);
+
+      // return size bytes of storage aligned for any node type
+      void* allocate(size_t size);
+
+      // free all blocks and everything allocated from them, without running destructors
+      void release();
+  };
+
+  class Arena : public ArenaBase {
+    public:
+      constexpr Arena(size_t minimumBlockSize = 1024) : ArenaBase(minimumBlockSize) {};
+      ~Arena(); // calls release
+  };
+}
+
+// allocate an ObjectFlow node from an arena: new (arena) Object(type, instance, firstObject)
+// returns NULL when out of memory, the new expression then skips the constructor and returns NULL
+void* operator new(size_t size, ObjectFlow::ArenaBase& arena) noexcept;
+// only used if a node constructor throws, the storage is freed with the arena
+void operator delete(void* pointer, ObjectFlow::ArenaBase& arena);
+// arrays of node pointers, new (arena) Object*[count]
+void* operator new[](size_t size, ObjectFlow::ArenaBase& arena) noexcept;
+void operator delete[](void* pointer, ObjectFlow::ArenaBase& arena);
@@ -0,0 +1,15 @@
+/* chainhead is the timed head of the chains in the compiled flow benchmark of objectflow-bench */
+
+namespace ObjectFlow
+{
+  // type of the head, a type of its own so the compiled flows call ChainHead::onInterval
+  const uint16_t chainHeadType = 43100;
+
+  // a TestObject that pushes its value on each interval. It isn't made by applicationObject, the benchmark adds 
+  // it with ObjectList::addObject, so it isn't in the switches of OBJECTFLOW_STATIC_DISPATCH
+  class ChainHead: public TestObject {
+    public:
+      ChainHead(uint16_t type, uint16_t instance, Object* listFirstObject) : TestObject(type, instance, listFirstObject) {};
+      void onInterval() { syncToOutputLink(); };
+  };
+}
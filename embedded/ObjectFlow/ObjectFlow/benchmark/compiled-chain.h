@@ -0,0 +1,879 @@
+// Generated by ObjectFlow builder
+// Compiled flows, build with OBJECTFLOW_COMPILED_FLOW
+namespace ObjectFlow
+{
+  // [43100, 0] interval => [43000, 1] => [43000, 2] => [43000, 3]
+  class CompiledFlow_43100_0 {
+    public:
+      ObjectListBase* list;
+      ChainHead* object_43100_0;
+      TestObject* object_43000_1;
+      TestObject* object_43000_2;
+      TestObject* object_43000_3;
+      Resource* currentTime;
+      Resource* intervalTime;
+      Resource* lastActivationTime;
+      Resource* source_43100_0;
+      Resource* source_43000_1;
+      Resource* destination_43000_1;
+      Resource* source_43000_2;
+      Resource* destination_43000_2;
+      Resource* destination_43000_3;
+
+      // resolve the Objects and Resources of the flow in an ObjectList, returns false if one is missing
+      bool bind(ObjectListBase* flowList) {
+        list = flowList;
+        object_43100_0 = static_cast<ChainHead*>(list -> getObjectByID(43100, 0));
+        object_43000_1 = static_cast<TestObject*>(list -> getObjectByID(43000, 1));
+        object_43000_2 = static_cast<TestObject*>(list -> getObjectByID(43000, 2));
+        object_43000_3 = static_cast<TestObject*>(list -> getObjectByID(43000, 3));
+        if (NULL == object_43100_0 || NULL == object_43000_1 || NULL == object_43000_2 || NULL == object_43000_3) {
+          printf("CompiledFlow_43100_0 can't bind the Objects\n");
+          return false;
+        }
+        currentTime = object_43100_0 -> getResourceByID(27005, 0);
+        intervalTime = object_43100_0 -> getResourceByID(27006, 0);
+        lastActivationTime = object_43100_0 -> getResourceByID(27007, 0);
+        source_43100_0 = object_43100_0 -> getResourceByID(27003, 0);
+        source_43000_1 = object_43000_1 -> getResourceByID(27003, 0);
+        destination_43000_1 = object_43000_1 -> getResourceByID(27003, 0);
+        source_43000_2 = object_43000_2 -> getResourceByID(27003, 0);
+        destination_43000_2 = object_43000_2 -> getResourceByID(27003, 0);
+        destination_43000_3 = object_43000_3 -> getResourceByID(27003, 0);
+        if (NULL == currentTime || NULL == intervalTime || NULL == lastActivationTime || NULL == source_43100_0 || NULL == source_43000_1 || NULL == destination_43000_1 || NULL == source_43000_2 || NULL == destination_43000_2 || NULL == destination_43000_3) {
+          printf("CompiledFlow_43100_0 can't bind the Resources\n");
+          return false;
+        }
+        return true;
+      };
+
+      // run the flow if [43100, 0] is due at the time, as updateTimers and runFlow would, returns the number of Objects run
+      uint32_t run(time_t timeValue) {
+        currentTime -> set<time_t>(timeValue);
+        if (timeValue - lastActivationTime -> get<time_t>() < intervalTime -> get<time_t>()) {
+          return 0;
+        }
+        lastActivationTime -> set<time_t>(timeValue);
+        if (object_43100_0 -> timerIndex != noTimer) {
+          list -> rescheduleTimer(object_43100_0);
+        }
+        list -> linksCompiled = true; // the handlers' syncToOutputLink sets synced, the values are copied here
+        uint32_t run = 1;
+        AnyValueType value;
+        bool updated_43000_1 = false;
+        bool updated_43000_2 = false;
+        bool updated_43000_3 = false;
+        object_43100_0 -> synced = false;
+        object_43100_0 -> ChainHead::onInterval();
+        if (object_43100_0 -> synced) { // the handler propagates its value
+          // [43100, 0] => [43000, 1]
+          value = source_43100_0 -> getValue();
+          if (destination_43000_1 -> getValue().integerType != value.integerType) {
+            destination_43000_1 -> setValue(value);
+            updated_43000_1 = true;
+          }
+          else {
+            object_43000_1 -> suppressedCount++;
+          }
+        }
+        if (updated_43000_1) {
+          object_43000_1 -> synced = false;
+          object_43000_1 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_1 -> synced) { // the handler propagates its value
+            // [43000, 1] => [43000, 2]
+            value = source_43000_1 -> getValue();
+            if (destination_43000_2 -> getValue().integerType != value.integerType) {
+              destination_43000_2 -> setValue(value);
+              updated_43000_2 = true;
+            }
+            else {
+              object_43000_2 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_2) {
+          object_43000_2 -> synced = false;
+          object_43000_2 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_2 -> synced) { // the handler propagates its value
+            // [43000, 2] => [43000, 3]
+            value = source_43000_2 -> getValue();
+            if (destination_43000_3 -> getValue().integerType != value.integerType) {
+              destination_43000_3 -> setValue(value);
+              updated_43000_3 = true;
+            }
+            else {
+              object_43000_3 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_3) {
+          object_43000_3 -> TestObject::onDefaultValueUpdate();
+          run++;
+        }
+        list -> linksCompiled = false;
+        return run;
+      };
+  };
+
+  // [43100, 100] interval => [43000, 101] => [43000, 102] => [43000, 103] => [43000, 104] => [43000, 105] => [43000, 106] => [43000, 107] => [43000, 108] => [43000, 109] => [43000, 110] => [43000, 111] => [43000, 112] => [43000, 113] => [43000, 114] => [43000, 115] => [43000, 116] => [43000, 117] => [43000, 118] => [43000, 119] => [43000, 120] => [43000, 121] => [43000, 122] => [43000, 123] => [43000, 124] => [43000, 125] => [43000, 126] => [43000, 127] => [43000, 128] => [43000, 129] => [43000, 130] => [43000, 131]
+  class CompiledFlow_43100_100 {
+    public:
+      ObjectListBase* list;
+      ChainHead* object_43100_100;
+      TestObject* object_43000_101;
+      TestObject* object_43000_102;
+      TestObject* object_43000_103;
+      TestObject* object_43000_104;
+      TestObject* object_43000_105;
+      TestObject* object_43000_106;
+      TestObject* object_43000_107;
+      TestObject* object_43000_108;
+      TestObject* object_43000_109;
+      TestObject* object_43000_110;
+      TestObject* object_43000_111;
+      TestObject* object_43000_112;
+      TestObject* object_43000_113;
+      TestObject* object_43000_114;
+      TestObject* object_43000_115;
+      TestObject* object_43000_116;
+      TestObject* object_43000_117;
+      TestObject* object_43000_118;
+      TestObject* object_43000_119;
+      TestObject* object_43000_120;
+      TestObject* object_43000_121;
+      TestObject* object_43000_122;
+      TestObject* object_43000_123;
+      TestObject* object_43000_124;
+      TestObject* object_43000_125;
+      TestObject* object_43000_126;
+      TestObject* object_43000_127;
+      TestObject* object_43000_128;
+      TestObject* object_43000_129;
+      TestObject* object_43000_130;
+      TestObject* object_43000_131;
+      Resource* currentTime;
+      Resource* intervalTime;
+      Resource* lastActivationTime;
+      Resource* source_43100_100;
+      Resource* source_43000_101;
+      Resource* destination_43000_101;
+      Resource* source_43000_102;
+      Resource* destination_43000_102;
+      Resource* source_43000_103;
+      Resource* destination_43000_103;
+      Resource* source_43000_104;
+      Resource* destination_43000_104;
+      Resource* source_43000_105;
+      Resource* destination_43000_105;
+      Resource* source_43000_106;
+      Resource* destination_43000_106;
+      Resource* source_43000_107;
+      Resource* destination_43000_107;
+      Resource* source_43000_108;
+      Resource* destination_43000_108;
+      Resource* source_43000_109;
+      Resource* destination_43000_109;
+      Resource* source_43000_110;
+      Resource* destination_43000_110;
+      Resource* source_43000_111;
+      Resource* destination_43000_111;
+      Resource* source_43000_112;
+      Resource* destination_43000_112;
+      Resource* source_43000_113;
+      Resource* destination_43000_113;
+      Resource* source_43000_114;
+      Resource* destination_43000_114;
+      Resource* source_43000_115;
+      Resource* destination_43000_115;
+      Resource* source_43000_116;
+      Resource* destination_43000_116;
+      Resource* source_43000_117;
+      Resource* destination_43000_117;
+      Resource* source_43000_118;
+      Resource* destination_43000_118;
+      Resource* source_43000_119;
+      Resource* destination_43000_119;
+      Resource* source_43000_120;
+      Resource* destination_43000_120;
+      Resource* source_43000_121;
+      Resource* destination_43000_121;
+      Resource* source_43000_122;
+      Resource* destination_43000_122;
+      Resource* source_43000_123;
+      Resource* destination_43000_123;
+      Resource* source_43000_124;
+      Resource* destination_43000_124;
+      Resource* source_43000_125;
+      Resource* destination_43000_125;
+      Resource* source_43000_126;
+      Resource* destination_43000_126;
+      Resource* source_43000_127;
+      Resource* destination_43000_127;
+      Resource* source_43000_128;
+      Resource* destination_43000_128;
+      Resource* source_43000_129;
+      Resource* destination_43000_129;
+      Resource* source_43000_130;
+      Resource* destination_43000_130;
+      Resource* destination_43000_131;
+
+      // resolve the Objects and Resources of the flow in an ObjectList, returns false if one is missing
+      bool bind(ObjectListBase* flowList) {
+        list = flowList;
+        object_43100_100 = static_cast<ChainHead*>(list -> getObjectByID(43100, 100));
+        object_43000_101 = static_cast<TestObject*>(list -> getObjectByID(43000, 101));
+        object_43000_102 = static_cast<TestObject*>(list -> getObjectByID(43000, 102));
+        object_43000_103 = static_cast<TestObject*>(list -> getObjectByID(43000, 103));
+        object_43000_104 = static_cast<TestObject*>(list -> getObjectByID(43000, 104));
+        object_43000_105 = static_cast<TestObject*>(list -> getObjectByID(43000, 105));
+        object_43000_106 = static_cast<TestObject*>(list -> getObjectByID(43000, 106));
+        object_43000_107 = static_cast<TestObject*>(list -> getObjectByID(43000, 107));
+        object_43000_108 = static_cast<TestObject*>(list -> getObjectByID(43000, 108));
+        object_43000_109 = static_cast<TestObject*>(list -> getObjectByID(43000, 109));
+        object_43000_110 = static_cast<TestObject*>(list -> getObjectByID(43000, 110));
+        object_43000_111 = static_cast<TestObject*>(list -> getObjectByID(43000, 111));
+        object_43000_112 = static_cast<TestObject*>(list -> getObjectByID(43000, 112));
+        object_43000_113 = static_cast<TestObject*>(list -> getObjectByID(43000, 113));
+        object_43000_114 = static_cast<TestObject*>(list -> getObjectByID(43000, 114));
+        object_43000_115 = static_cast<TestObject*>(list -> getObjectByID(43000, 115));
+        object_43000_116 = static_cast<TestObject*>(list -> getObjectByID(43000, 116));
+        object_43000_117 = static_cast<TestObject*>(list -> getObjectByID(43000, 117));
+        object_43000_118 = static_cast<TestObject*>(list -> getObjectByID(43000, 118));
+        object_43000_119 = static_cast<TestObject*>(list -> getObjectByID(43000, 119));
+        object_43000_120 = static_cast<TestObject*>(list -> getObjectByID(43000, 120));
+        object_43000_121 = static_cast<TestObject*>(list -> getObjectByID(43000, 121));
+        object_43000_122 = static_cast<TestObject*>(list -> getObjectByID(43000, 122));
+        object_43000_123 = static_cast<TestObject*>(list -> getObjectByID(43000, 123));
+        object_43000_124 = static_cast<TestObject*>(list -> getObjectByID(43000, 124));
+        object_43000_125 = static_cast<TestObject*>(list -> getObjectByID(43000, 125));
+        object_43000_126 = static_cast<TestObject*>(list -> getObjectByID(43000, 126));
+        object_43000_127 = static_cast<TestObject*>(list -> getObjectByID(43000, 127));
+        object_43000_128 = static_cast<TestObject*>(list -> getObjectByID(43000, 128));
+        object_43000_129 = static_cast<TestObject*>(list -> getObjectByID(43000, 129));
+        object_43000_130 = static_cast<TestObject*>(list -> getObjectByID(43000, 130));
+        object_43000_131 = static_cast<TestObject*>(list -> getObjectByID(43000, 131));
+        if (NULL == object_43100_100 || NULL == object_43000_101 || NULL == object_43000_102 || NULL == object_43000_103 || NULL == object_43000_104 || NULL == object_43000_105 || NULL == object_43000_106 || NULL == object_43000_107 || NULL == object_43000_108 || NULL == object_43000_109 || NULL == object_43000_110 || NULL == object_43000_111 || NULL == object_43000_112 || NULL == object_43000_113 || NULL == object_43000_114 || NULL == object_43000_115 || NULL == object_43000_116 || NULL == object_43000_117 || NULL == object_43000_118 || NULL == object_43000_119 || NULL == object_43000_120 || NULL == object_43000_121 || NULL == object_43000_122 || NULL == object_43000_123 || NULL == object_43000_124 || NULL == object_43000_125 || NULL == object_43000_126 || NULL == object_43000_127 || NULL == object_43000_128 || NULL == object_43000_129 || NULL == object_43000_130 || NULL == object_43000_131) {
+          printf("CompiledFlow_43100_100 can't bind the Objects\n");
+          return false;
+        }
+        currentTime = object_43100_100 -> getResourceByID(27005, 0);
+        intervalTime = object_43100_100 -> getResourceByID(27006, 0);
+        lastActivationTime = object_43100_100 -> getResourceByID(27007, 0);
+        source_43100_100 = object_43100_100 -> getResourceByID(27003, 0);
+        source_43000_101 = object_43000_101 -> getResourceByID(27003, 0);
+        destination_43000_101 = object_43000_101 -> getResourceByID(27003, 0);
+        source_43000_102 = object_43000_102 -> getResourceByID(27003, 0);
+        destination_43000_102 = object_43000_102 -> getResourceByID(27003, 0);
+        source_43000_103 = object_43000_103 -> getResourceByID(27003, 0);
+        destination_43000_103 = object_43000_103 -> getResourceByID(27003, 0);
+        source_43000_104 = object_43000_104 -> getResourceByID(27003, 0);
+        destination_43000_104 = object_43000_104 -> getResourceByID(27003, 0);
+        source_43000_105 = object_43000_105 -> getResourceByID(27003, 0);
+        destination_43000_105 = object_43000_105 -> getResourceByID(27003, 0);
+        source_43000_106 = object_43000_106 -> getResourceByID(27003, 0);
+        destination_43000_106 = object_43000_106 -> getResourceByID(27003, 0);
+        source_43000_107 = object_43000_107 -> getResourceByID(27003, 0);
+        destination_43000_107 = object_43000_107 -> getResourceByID(27003, 0);
+        source_43000_108 = object_43000_108 -> getResourceByID(27003, 0);
+        destination_43000_108 = object_43000_108 -> getResourceByID(27003, 0);
+        source_43000_109 = object_43000_109 -> getResourceByID(27003, 0);
+        destination_43000_109 = object_43000_109 -> getResourceByID(27003, 0);
+        source_43000_110 = object_43000_110 -> getResourceByID(27003, 0);
+        destination_43000_110 = object_43000_110 -> getResourceByID(27003, 0);
+        source_43000_111 = object_43000_111 -> getResourceByID(27003, 0);
+        destination_43000_111 = object_43000_111 -> getResourceByID(27003, 0);
+        source_43000_112 = object_43000_112 -> getResourceByID(27003, 0);
+        destination_43000_112 = object_43000_112 -> getResourceByID(27003, 0);
+        source_43000_113 = object_43000_113 -> getResourceByID(27003, 0);
+        destination_43000_113 = object_43000_113 -> getResourceByID(27003, 0);
+        source_43000_114 = object_43000_114 -> getResourceByID(27003, 0);
+        destination_43000_114 = object_43000_114 -> getResourceByID(27003, 0);
+        source_43000_115 = object_43000_115 -> getResourceByID(27003, 0);
+        destination_43000_115 = object_43000_115 -> getResourceByID(27003, 0);
+        source_43000_116 = object_43000_116 -> getResourceByID(27003, 0);
+        destination_43000_116 = object_43000_116 -> getResourceByID(27003, 0);
+        source_43000_117 = object_43000_117 -> getResourceByID(27003, 0);
+        destination_43000_117 = object_43000_117 -> getResourceByID(27003, 0);
+        source_43000_118 = object_43000_118 -> getResourceByID(27003, 0);
+        destination_43000_118 = object_43000_118 -> getResourceByID(27003, 0);
+        source_43000_119 = object_43000_119 -> getResourceByID(27003, 0);
+        destination_43000_119 = object_43000_119 -> getResourceByID(27003, 0);
+        source_43000_120 = object_43000_120 -> getResourceByID(27003, 0);
+        destination_43000_120 = object_43000_120 -> getResourceByID(27003, 0);
+        source_43000_121 = object_43000_121 -> getResourceByID(27003, 0);
+        destination_43000_121 = object_43000_121 -> getResourceByID(27003, 0);
+        source_43000_122 = object_43000_122 -> getResourceByID(27003, 0);
+        destination_43000_122 = object_43000_122 -> getResourceByID(27003, 0);
+        source_43000_123 = object_43000_123 -> getResourceByID(27003, 0);
+        destination_43000_123 = object_43000_123 -> getResourceByID(27003, 0);
+        source_43000_124 = object_43000_124 -> getResourceByID(27003, 0);
+        destination_43000_124 = object_43000_124 -> getResourceByID(27003, 0);
+        source_43000_125 = object_43000_125 -> getResourceByID(27003, 0);
+        destination_43000_125 = object_43000_125 -> getResourceByID(27003, 0);
+        source_43000_126 = object_43000_126 -> getResourceByID(27003, 0);
+        destination_43000_126 = object_43000_126 -> getResourceByID(27003, 0);
+        source_43000_127 = object_43000_127 -> getResourceByID(27003, 0);
+        destination_43000_127 = object_43000_127 -> getResourceByID(27003, 0);
+        source_43000_128 = object_43000_128 -> getResourceByID(27003, 0);
+        destination_43000_128 = object_43000_128 -> getResourceByID(27003, 0);
+        source_43000_129 = object_43000_129 -> getResourceByID(27003, 0);
+        destination_43000_129 = object_43000_129 -> getResourceByID(27003, 0);
+        source_43000_130 = object_43000_130 -> getResourceByID(27003, 0);
+        destination_43000_130 = object_43000_130 -> getResourceByID(27003, 0);
+        destination_43000_131 = object_43000_131 -> getResourceByID(27003, 0);
+        if (NULL == currentTime || NULL == intervalTime || NULL == lastActivationTime || NULL == source_43100_100 || NULL == source_43000_101 || NULL == destination_43000_101 || NULL == source_43000_102 || NULL == destination_43000_102 || NULL == source_43000_103 || NULL == destination_43000_103 || NULL == source_43000_104 || NULL == destination_43000_104 || NULL == source_43000_105 || NULL == destination_43000_105 || NULL == source_43000_106 || NULL == destination_43000_106 || NULL == source_43000_107 || NULL == destination_43000_107 || NULL == source_43000_108 || NULL == destination_43000_108 || NULL == source_43000_109 || NULL == destination_43000_109 || NULL == source_43000_110 || NULL == destination_43000_110 || NULL == source_43000_111 || NULL == destination_43000_111 || NULL == source_43000_112 || NULL == destination_43000_112 || NULL == source_43000_113 || NULL == destination_43000_113 || NULL == source_43000_114 || NULL == destination_43000_114 || NULL == source_43000_115 || NULL == destination_43000_115 || NULL == source_43000_116 || NULL == destination_43000_116 || NULL == source_43000_117 || NULL == destination_43000_117 || NULL == source_43000_118 || NULL == destination_43000_118 || NULL == source_43000_119 || NULL == destination_43000_119 || NULL == source_43000_120 || NULL == destination_43000_120 || NULL == source_43000_121 || NULL == destination_43000_121 || NULL == source_43000_122 || NULL == destination_43000_122 || NULL == source_43000_123 || NULL == destination_43000_123 || NULL == source_43000_124 || NULL == destination_43000_124 || NULL == source_43000_125 || NULL == destination_43000_125 || NULL == source_43000_126 || NULL == destination_43000_126 || NULL == source_43000_127 || NULL == destination_43000_127 || NULL == source_43000_128 || NULL == destination_43000_128 || NULL == source_43000_129 || NULL == destination_43000_129 || NULL == source_43000_130 || NULL == destination_43000_130 || NULL == destination_43000_131) {
+          printf("CompiledFlow_43100_100 can't bind the Resources\n");
+          return false;
+        }
+        return true;
+      };
+
+      // run the flow if [43100, 100] is due at the time, as updateTimers and runFlow would, returns the number of Objects run
+      uint32_t run(time_t timeValue) {
+        currentTime -> set<time_t>(timeValue);
+        if (timeValue - lastActivationTime -> get<time_t>() < intervalTime -> get<time_t>()) {
+          return 0;
+        }
+        lastActivationTime -> set<time_t>(timeValue);
+        if (object_43100_100 -> timerIndex != noTimer) {
+          list -> rescheduleTimer(object_43100_100);
+        }
+        list -> linksCompiled = true; // the handlers' syncToOutputLink sets synced, the values are copied here
+        uint32_t run = 1;
+        AnyValueType value;
+        bool updated_43000_101 = false;
+        bool updated_43000_102 = false;
+        bool updated_43000_103 = false;
+        bool updated_43000_104 = false;
+        bool updated_43000_105 = false;
+        bool updated_43000_106 = false;
+        bool updated_43000_107 = false;
+        bool updated_43000_108 = false;
+        bool updated_43000_109 = false;
+        bool updated_43000_110 = false;
+        bool updated_43000_111 = false;
+        bool updated_43000_112 = false;
+        bool updated_43000_113 = false;
+        bool updated_43000_114 = false;
+        bool updated_43000_115 = false;
+        bool updated_43000_116 = false;
+        bool updated_43000_117 = false;
+        bool updated_43000_118 = false;
+        bool updated_43000_119 = false;
+        bool updated_43000_120 = false;
+        bool updated_43000_121 = false;
+        bool updated_43000_122 = false;
+        bool updated_43000_123 = false;
+        bool updated_43000_124 = false;
+        bool updated_43000_125 = false;
+        bool updated_43000_126 = false;
+        bool updated_43000_127 = false;
+        bool updated_43000_128 = false;
+        bool updated_43000_129 = false;
+        bool updated_43000_130 = false;
+        bool updated_43000_131 = false;
+        object_43100_100 -> synced = false;
+        object_43100_100 -> ChainHead::onInterval();
+        if (object_43100_100 -> synced) { // the handler propagates its value
+          // [43100, 100] => [43000, 101]
+          value = source_43100_100 -> getValue();
+          if (destination_43000_101 -> getValue().integerType != value.integerType) {
+            destination_43000_101 -> setValue(value);
+            updated_43000_101 = true;
+          }
+          else {
+            object_43000_101 -> suppressedCount++;
+          }
+        }
+        if (updated_43000_101) {
+          object_43000_101 -> synced = false;
+          object_43000_101 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_101 -> synced) { // the handler propagates its value
+            // [43000, 101] => [43000, 102]
+            value = source_43000_101 -> getValue();
+            if (destination_43000_102 -> getValue().integerType != value.integerType) {
+              destination_43000_102 -> setValue(value);
+              updated_43000_102 = true;
+            }
+            else {
+              object_43000_102 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_102) {
+          object_43000_102 -> synced = false;
+          object_43000_102 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_102 -> synced) { // the handler propagates its value
+            // [43000, 102] => [43000, 103]
+            value = source_43000_102 -> getValue();
+            if (destination_43000_103 -> getValue().integerType != value.integerType) {
+              destination_43000_103 -> setValue(value);
+              updated_43000_103 = true;
+            }
+            else {
+              object_43000_103 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_103) {
+          object_43000_103 -> synced = false;
+          object_43000_103 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_103 -> synced) { // the handler propagates its value
+            // [43000, 103] => [43000, 104]
+            value = source_43000_103 -> getValue();
+            if (destination_43000_104 -> getValue().integerType != value.integerType) {
+              destination_43000_104 -> setValue(value);
+              updated_43000_104 = true;
+            }
+            else {
+              object_43000_104 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_104) {
+          object_43000_104 -> synced = false;
+          object_43000_104 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_104 -> synced) { // the handler propagates its value
+            // [43000, 104] => [43000, 105]
+            value = source_43000_104 -> getValue();
+            if (destination_43000_105 -> getValue().integerType != value.integerType) {
+              destination_43000_105 -> setValue(value);
+              updated_43000_105 = true;
+            }
+            else {
+              object_43000_105 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_105) {
+          object_43000_105 -> synced = false;
+          object_43000_105 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_105 -> synced) { // the handler propagates its value
+            // [43000, 105] => [43000, 106]
+            value = source_43000_105 -> getValue();
+            if (destination_43000_106 -> getValue().integerType != value.integerType) {
+              destination_43000_106 -> setValue(value);
+              updated_43000_106 = true;
+            }
+            else {
+              object_43000_106 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_106) {
+          object_43000_106 -> synced = false;
+          object_43000_106 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_106 -> synced) { // the handler propagates its value
+            // [43000, 106] => [43000, 107]
+            value = source_43000_106 -> getValue();
+            if (destination_43000_107 -> getValue().integerType != value.integerType) {
+              destination_43000_107 -> setValue(value);
+              updated_43000_107 = true;
+            }
+            else {
+              object_43000_107 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_107) {
+          object_43000_107 -> synced = false;
+          object_43000_107 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_107 -> synced) { // the handler propagates its value
+            // [43000, 107] => [43000, 108]
+            value = source_43000_107 -> getValue();
+            if (destination_43000_108 -> getValue().integerType != value.integerType) {
+              destination_43000_108 -> setValue(value);
+              updated_43000_108 = true;
+            }
+            else {
+              object_43000_108 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_108) {
+          object_43000_108 -> synced = false;
+          object_43000_108 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_108 -> synced) { // the handler propagates its value
+            // [43000, 108] => [43000, 109]
+            value = source_43000_108 -> getValue();
+            if (destination_43000_109 -> getValue().integerType != value.integerType) {
+              destination_43000_109 -> setValue(value);
+              updated_43000_109 = true;
+            }
+            else {
+              object_43000_109 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_109) {
+          object_43000_109 -> synced = false;
+          object_43000_109 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_109 -> synced) { // the handler propagates its value
+            // [43000, 109] => [43000, 110]
+            value = source_43000_109 -> getValue();
+            if (destination_43000_110 -> getValue().integerType != value.integerType) {
+              destination_43000_110 -> setValue(value);
+              updated_43000_110 = true;
+            }
+            else {
+              object_43000_110 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_110) {
+          object_43000_110 -> synced = false;
+          object_43000_110 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_110 -> synced) { // the handler propagates its value
+            // [43000, 110] => [43000, 111]
+            value = source_43000_110 -> getValue();
+            if (destination_43000_111 -> getValue().integerType != value.integerType) {
+              destination_43000_111 -> setValue(value);
+              updated_43000_111 = true;
+            }
+            else {
+              object_43000_111 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_111) {
+          object_43000_111 -> synced = false;
+          object_43000_111 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_111 -> synced) { // the handler propagates its value
+            // [43000, 111] => [43000, 112]
+            value = source_43000_111 -> getValue();
+            if (destination_43000_112 -> getValue().integerType != value.integerType) {
+              destination_43000_112 -> setValue(value);
+              updated_43000_112 = true;
+            }
+            else {
+              object_43000_112 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_112) {
+          object_43000_112 -> synced = false;
+          object_43000_112 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_112 -> synced) { // the handler propagates its value
+            // [43000, 112] => [43000, 113]
+            value = source_43000_112 -> getValue();
+            if (destination_43000_113 -> getValue().integerType != value.integerType) {
+              destination_43000_113 -> setValue(value);
+              updated_43000_113 = true;
+            }
+            else {
+              object_43000_113 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_113) {
+          object_43000_113 -> synced = false;
+          object_43000_113 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_113 -> synced) { // the handler propagates its value
+            // [43000, 113] => [43000, 114]
+            value = source_43000_113 -> getValue();
+            if (destination_43000_114 -> getValue().integerType != value.integerType) {
+              destination_43000_114 -> setValue(value);
+              updated_43000_114 = true;
+            }
+            else {
+              object_43000_114 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_114) {
+          object_43000_114 -> synced = false;
+          object_43000_114 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_114 -> synced) { // the handler propagates its value
+            // [43000, 114] => [43000, 115]
+            value = source_43000_114 -> getValue();
+            if (destination_43000_115 -> getValue().integerType != value.integerType) {
+              destination_43000_115 -> setValue(value);
+              updated_43000_115 = true;
+            }
+            else {
+              object_43000_115 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_115) {
+          object_43000_115 -> synced = false;
+          object_43000_115 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_115 -> synced) { // the handler propagates its value
+            // [43000, 115] => [43000, 116]
+            value = source_43000_115 -> getValue();
+            if (destination_43000_116 -> getValue().integerType != value.integerType) {
+              destination_43000_116 -> setValue(value);
+              updated_43000_116 = true;
+            }
+            else {
+              object_43000_116 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_116) {
+          object_43000_116 -> synced = false;
+          object_43000_116 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_116 -> synced) { // the handler propagates its value
+            // [43000, 116] => [43000, 117]
+            value = source_43000_116 -> getValue();
+            if (destination_43000_117 -> getValue().integerType != value.integerType) {
+              destination_43000_117 -> setValue(value);
+              updated_43000_117 = true;
+            }
+            else {
+              object_43000_117 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_117) {
+          object_43000_117 -> synced = false;
+          object_43000_117 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_117 -> synced) { // the handler propagates its value
+            // [43000, 117] => [43000, 118]
+            value = source_43000_117 -> getValue();
+            if (destination_43000_118 -> getValue().integerType != value.integerType) {
+              destination_43000_118 -> setValue(value);
+              updated_43000_118 = true;
+            }
+            else {
+              object_43000_118 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_118) {
+          object_43000_118 -> synced = false;
+          object_43000_118 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_118 -> synced) { // the handler propagates its value
+            // [43000, 118] => [43000, 119]
+            value = source_43000_118 -> getValue();
+            if (destination_43000_119 -> getValue().integerType != value.integerType) {
+              destination_43000_119 -> setValue(value);
+              updated_43000_119 = true;
+            }
+            else {
+              object_43000_119 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_119) {
+          object_43000_119 -> synced = false;
+          object_43000_119 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_119 -> synced) { // the handler propagates its value
+            // [43000, 119] => [43000, 120]
+            value = source_43000_119 -> getValue();
+            if (destination_43000_120 -> getValue().integerType != value.integerType) {
+              destination_43000_120 -> setValue(value);
+              updated_43000_120 = true;
+            }
+            else {
+              object_43000_120 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_120) {
+          object_43000_120 -> synced = false;
+          object_43000_120 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_120 -> synced) { // the handler propagates its value
+            // [43000, 120] => [43000, 121]
+            value = source_43000_120 -> getValue();
+            if (destination_43000_121 -> getValue().integerType != value.integerType) {
+              destination_43000_121 -> setValue(value);
+              updated_43000_121 = true;
+            }
+            else {
+              object_43000_121 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_121) {
+          object_43000_121 -> synced = false;
+          object_43000_121 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_121 -> synced) { // the handler propagates its value
+            // [43000, 121] => [43000, 122]
+            value = source_43000_121 -> getValue();
+            if (destination_43000_122 -> getValue().integerType != value.integerType) {
+              destination_43000_122 -> setValue(value);
+              updated_43000_122 = true;
+            }
+            else {
+              object_43000_122 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_122) {
+          object_43000_122 -> synced = false;
+          object_43000_122 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_122 -> synced) { // the handler propagates its value
+            // [43000, 122] => [43000, 123]
+            value = source_43000_122 -> getValue();
+            if (destination_43000_123 -> getValue().integerType != value.integerType) {
+              destination_43000_123 -> setValue(value);
+              updated_43000_123 = true;
+            }
+            else {
+              object_43000_123 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_123) {
+          object_43000_123 -> synced = false;
+          object_43000_123 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_123 -> synced) { // the handler propagates its value
+            // [43000, 123] => [43000, 124]
+            value = source_43000_123 -> getValue();
+            if (destination_43000_124 -> getValue().integerType != value.integerType) {
+              destination_43000_124 -> setValue(value);
+              updated_43000_124 = true;
+            }
+            else {
+              object_43000_124 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_124) {
+          object_43000_124 -> synced = false;
+          object_43000_124 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_124 -> synced) { // the handler propagates its value
+            // [43000, 124] => [43000, 125]
+            value = source_43000_124 -> getValue();
+            if (destination_43000_125 -> getValue().integerType != value.integerType) {
+              destination_43000_125 -> setValue(value);
+              updated_43000_125 = true;
+            }
+            else {
+              object_43000_125 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_125) {
+          object_43000_125 -> synced = false;
+          object_43000_125 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_125 -> synced) { // the handler propagates its value
+            // [43000, 125] => [43000, 126]
+            value = source_43000_125 -> getValue();
+            if (destination_43000_126 -> getValue().integerType != value.integerType) {
+              destination_43000_126 -> setValue(value);
+              updated_43000_126 = true;
+            }
+            else {
+              object_43000_126 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_126) {
+          object_43000_126 -> synced = false;
+          object_43000_126 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_126 -> synced) { // the handler propagates its value
+            // [43000, 126] => [43000, 127]
+            value = source_43000_126 -> getValue();
+            if (destination_43000_127 -> getValue().integerType != value.integerType) {
+              destination_43000_127 -> setValue(value);
+              updated_43000_127 = true;
+            }
+            else {
+              object_43000_127 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_127) {
+          object_43000_127 -> synced = false;
+          object_43000_127 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_127 -> synced) { // the handler propagates its value
+            // [43000, 127] => [43000, 128]
+            value = source_43000_127 -> getValue();
+            if (destination_43000_128 -> getValue().integerType != value.integerType) {
+              destination_43000_128 -> setValue(value);
+              updated_43000_128 = true;
+            }
+            else {
+              object_43000_128 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_128) {
+          object_43000_128 -> synced = false;
+          object_43000_128 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_128 -> synced) { // the handler propagates its value
+            // [43000, 128] => [43000, 129]
+            value = source_43000_128 -> getValue();
+            if (destination_43000_129 -> getValue().integerType != value.integerType) {
+              destination_43000_129 -> setValue(value);
+              updated_43000_129 = true;
+            }
+            else {
+              object_43000_129 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_129) {
+          object_43000_129 -> synced = false;
+          object_43000_129 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_129 -> synced) { // the handler propagates its value
+            // [43000, 129] => [43000, 130]
+            value = source_43000_129 -> getValue();
+            if (destination_43000_130 -> getValue().integerType != value.integerType) {
+              destination_43000_130 -> setValue(value);
+              updated_43000_130 = true;
+            }
+            else {
+              object_43000_130 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_130) {
+          object_43000_130 -> synced = false;
+          object_43000_130 -> TestObject::onDefaultValueUpdate();
+          run++;
+          if (object_43000_130 -> synced) { // the handler propagates its value
+            // [43000, 130] => [43000, 131]
+            value = source_43000_130 -> getValue();
+            if (destination_43000_131 -> getValue().integerType != value.integerType) {
+              destination_43000_131 -> setValue(value);
+              updated_43000_131 = true;
+            }
+            else {
+              object_43000_131 -> suppressedCount++;
+            }
+          }
+        }
+        if (updated_43000_131) {
+          object_43000_131 -> TestObject::onDefaultValueUpdate();
+          run++;
+        }
+        list -> linksCompiled = false;
+        return run;
+      };
+  };
+
+}
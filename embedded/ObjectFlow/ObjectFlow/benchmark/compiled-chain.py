@@ -0,0 +1,33 @@
+# compiled-chain writes compiled-chain.h, the compiled flows of the chains of TestObjects in objectflow-bench, 
+# with the builder's compiledFlowHeader. Run it from the benchmark directory: python3 compiled-chain.py
+
+import re
+import sys
+sys.path.append("../../Builder")
+import builder
+
+# the runtime's resource type IDs, from the defines in objectflow.h, which differ from the model's
+with open("../objectflow.h") as runtimeHeader:
+  resourceTypeIDs = { name: int(typeID) for name, typeID in re.findall(r"^#define (\w+)Type (\d+)", runtimeHeader.read(), re.M) }
+
+# the head of each chain is a ChainHead, see chainhead.h
+chainHeadType = 43100
+
+def chainRows(first, length):
+  # a chain of TestObjects from instance first after a ChainHead with the timer resources and IntervalTime 1, as benchChain makes it
+  rows = []
+  def row(instance, typeName, valueType, data, link = None):
+    rows.append( { "oid": chainHeadType if instance == first else 43000, "oinst": instance, "rid": resourceTypeIDs[typeName], "rinst": 0, 
+      "type": valueType, "value": str(data), "link": link, "data": link if link is not None else data } )
+  for instance in range(first, first + length):
+    row(instance, "CurrentValue", "integerType", 0)
+    if instance == first:
+      row(instance, "CurrentTime", "timeType", 0)
+      row(instance, "IntervalTime", "timeType", 1)
+      row(instance, "LastActivationTime", "timeType", 0)
+    if instance + 1 < first + length:
+      row(instance, "OutputLink", "linkType", None, (43000, instance + 1))
+  return rows
+
+with open("compiled-chain.h", "w") as header:
+  header.write(builder.compiledFlowHeader(chainRows(0, 4) + chainRows(100, 32), { 43000: "TestObject", chainHeadType: "ChainHead" }, resourceTypeIDs) + "\n")
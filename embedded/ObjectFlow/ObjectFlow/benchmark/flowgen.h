@@ -0,0 +1,121 @@
+/* flowgen makes synthetic instance tables for the ObjectFlow benchmarks */
+
+// the harnesses include <time.h> before objectflow.h, which defines time_t
+
+namespace ObjectFlow
+{
+  // monotonic time in nanoseconds
+  inline double nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+  };
+
+  // small LCG so the access pattern is repeatable between runs
+  inline uint32_t benchRandom(uint32_t* state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+  };
+
+  // synthetic objects are spread over several types so instance IDs stay in range
+  inline uint16_t syntheticType(uint32_t n) { return 44000 + n % 97; };
+  inline uint16_t syntheticInstance(uint32_t n) { return n / 97; };
+
+  // synthetic instance table, each object has values and an output link to the next object
+  const uint32_t syntheticRowsPerObject = 4;
+
+  inline InstanceTemplate* syntheticTable(uint32_t rows) {
+    InstanceTemplate* table = new InstanceTemplate[rows];
+    for (uint32_t row = 0; row < rows; row++) {
+      uint32_t n = row / syntheticRowsPerObject;
+      InstanceTemplate* instance = &table[row];
+      instance -> objectTypeID = syntheticType(n);
+      instance -> objectInstanceID = syntheticInstance(n);
+      instance -> resourceInstanceID = 0;
+      switch (row % syntheticRowsPerObject) {
+        case 0: instance -> resourceTypeID = InputValueType; instance -> valueType = integerType; instance -> value.integerType = 0; break;
+        case 1: instance -> resourceTypeID = CurrentValueType; instance -> valueType = integerType; instance -> value.integerType = n; break;
+        case 2: instance -> resourceTypeID = IntervalTimeType; instance -> valueType = timeType; instance -> value.timeType = 1000; break;
+        default: 
+          instance -> resourceTypeID = OutputLinkType; 
+          instance -> valueType = linkType; 
+          instance -> value.linkType.typeID = syntheticType(n + 1); 
+          instance -> value.linkType.instanceID = syntheticInstance(n + 1); 
+      }
+    };
+    // the last object links back to the first so there are no dangling links
+    table[rows - 1].value.linkType.typeID = syntheticType(0);
+    table[rows - 1].value.linkType.instanceID = syntheticInstance(0);
+    return table;
+  };
+
+  // instance table of objects that each have the same number of integer resources
+  inline InstanceTemplate* resourceTable(uint32_t objects, uint32_t resources) {
+    InstanceTemplate* table = new InstanceTemplate[objects * resources];
+    for (uint32_t row = 0; row < objects * resources; row++) {
+      InstanceTemplate* instance = &table[row];
+      instance -> objectTypeID = syntheticType(row / resources);
+      instance -> objectInstanceID = syntheticInstance(row / resources);
+      instance -> resourceTypeID = 30000 + row % resources;
+      instance -> resourceInstanceID = 0;
+      instance -> valueType = integerType;
+      instance -> value.integerType = row;
+    };
+    return table;
+  };
+
+  /*
+  A synthetic flow is a grid of TestObjects (type 43000, which push to their outputs) in depth layers.
+  Each object has a CurrentValue, resources - 1 extra integer resources (types 30000 and up), the timer
+  resources and a Deadband of -1 so every update propagates. Objects after the first layer have an InputLink
+  from the object at the same position in the layer before, and objects before the last layer have fanout
+  OutputLinks to the objects at the same and following positions in the next layer. Instance IDs are 16 bits,
+  so there are at most 65535 objects.
+  */
+  struct FlowShape {
+    uint32_t objects;
+    uint32_t resources; // value resources per object, at least 1
+    uint32_t fanout; // OutputLinks per object, at most the layer width
+    uint32_t depth; // layers, a chain is depth = objects
+  };
+
+  // objects in a layer of the flow
+  inline uint32_t flowWidth(const FlowShape& shape) {
+    return (shape.objects + shape.depth - 1) / shape.depth;
+  };
+
+  // rows of the instance table for a shape
+  inline uint32_t flowRows(const FlowShape& shape) {
+    return shape.objects * (shape.resources + 5 + shape.fanout);
+  };
+
+  // make the instance table of a flow, returns the number of rows, which is at most flowRows
+  inline uint32_t generateFlow(const FlowShape& shape, InstanceTemplate* table) {
+    uint32_t width = flowWidth(shape);
+    uint32_t row = 0;
+    for (uint32_t n = 0; n < shape.objects; n++) {
+      uint16_t instance = (uint16_t)n;
+      uint32_t layer = n / width;
+      uint32_t position = n % width;
+      table[row++] = (InstanceTemplate){ 43000, instance, CurrentValueType, 0, integerType, (AnyValueType){ .integerType = (int)n } };
+      for (uint32_t resource = 1; resource < shape.resources; resource++) {
+        table[row++] = (InstanceTemplate){ 43000, instance, (uint16_t)(30000 + resource), 0, integerType, (AnyValueType){ .integerType = (int)resource } };
+      };
+      table[row++] = (InstanceTemplate){ 43000, instance, DeadbandType, 0, floatType, (AnyValueType){ .floatType = -1 } };
+      table[row++] = (InstanceTemplate){ 43000, instance, CurrentTimeType, 0, timeType, (AnyValueType){ .timeType = 0 } };
+      table[row++] = (InstanceTemplate){ 43000, instance, IntervalTimeType, 0, timeType, (AnyValueType){ .timeType = 10 } };
+      table[row++] = (InstanceTemplate){ 43000, instance, LastActivationTimeType, 0, timeType, (AnyValueType){ .timeType = 0 } };
+      if (layer > 0) {
+        table[row++] = (InstanceTemplate){ 43000, instance, InputLinkType, 0, linkType, (AnyValueType){ .linkType = { 43000, (uint16_t)(n - width) } } };
+      }
+      uint32_t next = (layer + 1) * width; // first object of the next layer
+      for (uint32_t output = 0; output < shape.fanout && next < shape.objects; output++) {
+        uint32_t target = next + (position + output) % width;
+        if (target < shape.objects) { // the last layer may be short
+          table[row++] = (InstanceTemplate){ 43000, instance, OutputLinkType, (uint16_t)output, linkType, (AnyValueType){ .linkType = { 43000, (uint16_t)target } } };
+        }
+      };
+    };
+    return row;
+  };
+}
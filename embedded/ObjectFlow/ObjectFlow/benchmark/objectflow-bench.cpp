@@ -0,0 +1,1107 @@
+/* objectflow-bench measures the ObjectFlow runtime operations on synthetic object lists */
+
+#include <time.h>
+#include <string.h>
+#include <malloc.h>
+#include <unistd.h>
+#include <math.h>
+#ifdef OBJECTFLOW_SEQLOCK
+#include <pthread.h>
+#endif
+#include "../objectflow.h"
+#include "../handlers.h"
+#include "resourcestore.h"
+#include "flowgen.h"
+#ifdef OBJECTFLOW_COMPILED_FLOW
+#include "chainhead.h"
+#include "compiled-chain.h"
+#endif
+
+using namespace ObjectFlow;
+
+// the scan baseline is the linear walk that getObjectByID used before the index
+static Object* scanObjectByID(ObjectList* list, uint16_t type, uint16_t instance) {
+  Object* object = list -> firstObject;
+  while (object != NULL && (object -> typeID != type || object -> instanceID != instance)) {
+    object = object -> nextObject;
+  };
+  return object;
+};
+
+// lookup cost of ObjectList::getObjectByID should stay flat as the list grows
+static void benchObjectLookup() {
+  const uint32_t sizes[] = { 10, 100, 1000, 10000, 100000 };
+  printf("getObjectByID\n");
+  printf("  %8s %16s %16s\n", "objects", "ns/op (index)", "ns/op (scan)");
+  for (uint32_t s = 0; s < sizeof(sizes)/sizeof(uint32_t); s++) {
+    uint32_t count = sizes[s];
+    ObjectList* list = new ObjectList();
+    for (uint32_t n = 0; n < count; n++) {
+      list -> newObject(syntheticType(n), syntheticInstance(n));
+    };
+    uintptr_t check = 0;
+    uint32_t seed = 1;
+    uint32_t lookups = 1000000;
+    double start = nowNs();
+    for (uint32_t i = 0; i < lookups; i++) {
+      uint32_t n = benchRandom(&seed) % count;
+      check += (uintptr_t)list -> getObjectByID(syntheticType(n), syntheticInstance(n));
+    };
+    double indexNs = (nowNs() - start) / lookups;
+    uint32_t scans = (count > 10000 ? 1000 : 100000); // keep the quadratic baseline short
+    seed = 1;
+    start = nowNs();
+    for (uint32_t i = 0; i < scans; i++) {
+      uint32_t n = benchRandom(&seed) % count;
+      check += (uintptr_t)scanObjectByID(list, syntheticType(n), syntheticInstance(n));
+    };
+    double scanNs = (nowNs() - start) / scans;
+    printf("  %8u %16.1f %16.1f %s\n", count, indexNs, scanNs, 0 == check ? "(no objects found)" : "");
+  };
+};
+
+// startup time of ObjectList::buildInstances from an instance table
+static void benchBuildInstances() {
+  const uint32_t sizes[] = { 1000, 10000, 100000 };
+  printf("buildInstances\n");
+  printf("  %8s %8s %16s %16s\n", "rows", "objects", "ms total", "ns/row");
+  for (uint32_t s = 0; s < sizeof(sizes)/sizeof(uint32_t); s++) {
+    uint32_t rows = sizes[s];
+    InstanceTemplate* table = syntheticTable(rows);
+    ObjectList* list = new ObjectList();
+    double start = nowNs();
+    list -> buildInstances(table, rows);
+    double elapsed = nowNs() - start;
+    printf("  %8u %8u %16.3f %16.1f\n", rows, list -> objectCount, elapsed / 1e6, elapsed / rows);
+    delete[] table;
+  };
+};
+
+// bytes of heap in use, including blocks large enough to be mapped separately
+static size_t heapInUse() {
+  struct mallinfo2 info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+};
+
+// heap footprint and allocation count of the graph, per-node blocks (block size 0) are the
+// allocation pattern of a new per Object and Resource
+static void benchArena() {
+  const uint32_t sizes[] = { 1000, 10000, 100000 };
+  printf("arena\n");
+  printf("  %8s %10s %10s %12s %12s %12s %10s\n", "rows", "block", "nodes", "mallocs", "heap bytes", "node bytes", "ms build");
+  for (uint32_t s = 0; s < sizeof(sizes)/sizeof(uint32_t); s++) {
+    uint32_t rows = sizes[s];
+    InstanceTemplate* table = syntheticTable(rows);
+    for (uint32_t perNode = 0; perNode < 2; perNode++) {
+      ObjectList* list = new ObjectList();
+      list -> arena.blockSize = (perNode ? 0 : 1024);
+      size_t heapBefore = heapInUse();
+      double start = nowNs();
+      list -> buildInstances(table, rows);
+      double elapsed = nowNs() - start;
+      size_t heapAfter = heapInUse();
+      printf("  %8u %10s %10u %12u %12zu %12zu %10.3f\n", rows, perNode ? "per-node" : "sized", list -> arena.allocationCount, 
+        list -> arena.blockCount, heapAfter - heapBefore, list -> arena.bytesUsed, elapsed / 1e6);
+      start = nowNs();
+      delete list;
+      printf("  %8s %10s freed in %.3f ms\n", "", "", (nowNs() - start) / 1e6);
+    };
+    delete[] table;
+  };
+};
+
+// the chain baseline is the pointer-chasing loop that getResourceByID used before the keysearch kernel
+static Resource* scanResourceByID(Object* object, uint16_t type, uint16_t instance) {
+  Resource* resource = object -> firstResource;
+  while ( (resource != NULL) && (resource -> typeID != type || resource -> instanceID != instance) ) {
+    resource = resource -> nextResource;
+  };
+  return resource;
+};
+
+// resource lookup and a pass over all values, linked Resource lists against the ResourceStore arrays
+static void benchResourceStore() {
+  const uint32_t sizes[] = { 4, 16, 64 };
+  const uint32_t objects = 1000;
+  const uint32_t lookups = 1000000;
+  printf("getResourceByID, %s keysearch kernel\n", OBJECTFLOW_KEYSEARCH_KERNEL);
+  printf("  %10s %14s %14s %14s %14s %14s\n", "resources", "ns/op (chain)", "ns/op (kernel)", "ns/op (store)", "ns/value scan", "ns/value scan");
+  printf("  %10s %14s %14s %14s %14s %14s\n", "", "", "", "", "(list)", "(store)");
+  for (uint32_t s = 0; s < sizeof(sizes)/sizeof(uint32_t); s++) {
+    uint32_t resources = sizes[s];
+    InstanceTemplate* table = resourceTable(objects, resources);
+    ObjectList* list = new ObjectList();
+    list -> buildInstances(table, objects * resources);
+    ResourceStore* store = new ResourceStore();
+    store -> build(table, objects * resources);
+    Object** objectPointers = new Object*[objects];
+    uint32_t* objectSlots = new uint32_t[objects];
+    for (uint32_t n = 0; n < objects; n++) {
+      objectPointers[n] = list -> getObjectByID(syntheticType(n), syntheticInstance(n));
+      objectSlots[n] = store -> findObject(syntheticType(n), syntheticInstance(n));
+    };
+
+    uintptr_t check = 0;
+    uint32_t seed = 1;
+    double start = nowNs();
+    for (uint32_t i = 0; i < lookups; i++) {
+      uint32_t r = benchRandom(&seed);
+      check += scanResourceByID(objectPointers[r % objects], 30000 + (r >> 10) % resources, 0) -> value.integerType;
+    };
+    double chainNs = (nowNs() - start) / lookups;
+    seed = 1;
+    start = nowNs();
+    for (uint32_t i = 0; i < lookups; i++) {
+      uint32_t r = benchRandom(&seed);
+      check -= objectPointers[r % objects] -> getResourceByID(30000 + (r >> 10) % resources, 0) -> value.integerType;
+    };
+    double kernelNs = (nowNs() - start) / lookups;
+    seed = 1;
+    for (uint32_t i = 0; i < lookups; i++) { // the store is compared with the chain
+      uint32_t r = benchRandom(&seed);
+      check += objectPointers[r % objects] -> getResourceByID(30000 + (r >> 10) % resources, 0) -> value.integerType;
+    };
+    seed = 1;
+    start = nowNs();
+    for (uint32_t i = 0; i < lookups; i++) {
+      uint32_t r = benchRandom(&seed);
+      check -= store -> readValue(store -> findResource(objectSlots[r % objects], 30000 + (r >> 10) % resources, 0)).integerType;
+    };
+    double storeNs = (nowNs() - start) / lookups;
+
+    start = nowNs();
+    for (Object* object = list -> firstObject; object != NULL; object = object -> nextObject) {
+      for (Resource* resource = object -> firstResource; resource != NULL; resource = resource -> nextResource) {
+        check += resource -> value.integerType;
+      };
+    };
+    double listScanNs = (nowNs() - start) / (objects * resources);
+    start = nowNs();
+    for (uint32_t slot = 0; slot < store -> resourceCount; slot++) {
+      check -= store -> values[slot].integerType;
+    };
+    double storeScanNs = (nowNs() - start) / (objects * resources);
+
+    printf("  %10u %14.1f %14.1f %14.1f %14.2f %14.2f %s\n", resources, chainNs, kernelNs, storeNs, listScanNs, storeScanNs, check != 0 ? "(mismatch)" : "");
+    delete[] objectPointers;
+    delete[] objectSlots;
+    delete store;
+    delete list;
+    delete[] table;
+  };
+};
+
+// block writes of 50 registers per object, one updateValueByID per register (with the object lookup a driver 
+// does for each) against one updateValues call per block, which notifies once per object instead of once per register
+static void benchBatchUpdate() {
+  const uint32_t registers = 50;
+  const uint32_t blockObjects[] = { 1, 20, 200 };
+  const uint32_t objects = 1000;
+  InstanceTemplate* table = resourceTable(objects, registers);
+  ObjectList* list = new ObjectList();
+  list -> buildInstances(table, objects * registers);
+  printf("batched updates, %u registers per object\n", registers);
+  printf("  %8s %10s %16s %16s %16s %16s\n", "objects", "updates", "ns/update (call)", "ns/update (batch)", "notify (call)", "notify (batch)");
+  for (uint32_t b = 0; b < sizeof(blockObjects)/sizeof(uint32_t); b++) {
+    uint32_t count = blockObjects[b] * registers;
+    ValueUpdate* block = new ValueUpdate[count];
+    uint32_t blocks = 1000000 / count;
+    uintptr_t check = 0;
+    double start = nowNs();
+    for (uint32_t repeat = 0; repeat < blocks; repeat++) {
+      uint32_t firstObject = (repeat * blockObjects[b]) % objects;
+      for (uint32_t n = 0; n < count; n++) {
+        uint32_t object = (firstObject + n / registers) % objects;
+        AnyValueType value;
+        value.integerType = repeat + n;
+        list -> getObjectByID(syntheticType(object), syntheticInstance(object)) -> updateValueByID(30000 + n % registers, 0, value);
+      };
+    };
+    double callNs = (nowNs() - start) / blocks / count;
+    double batchNs = 0;
+    for (uint32_t repeat = 0; repeat < blocks; repeat++) {
+      uint32_t firstObject = (repeat * blockObjects[b]) % objects;
+      for (uint32_t n = 0; n < count; n++) { // filled outside the timing, as a driver receives it
+        uint32_t object = (firstObject + n / registers) % objects;
+        block[n] = (ValueUpdate){ syntheticType(object), syntheticInstance(object), (uint16_t)(30000 + n % registers), 0, (AnyValueType){ .integerType = (int)(repeat + n) } };
+      };
+      start = nowNs();
+      check += list -> updateValues(block, count);
+      batchNs += nowNs() - start;
+    };
+    batchNs = batchNs / blocks / count;
+    printf("  %8u %10u %16.1f %16.1f %16u %16u %s\n", blockObjects[b], count, callNs, batchNs, count, blockObjects[b], 
+      check != (uintptr_t)blocks * count ? "(updates missing)" : "");
+    delete[] block;
+  };
+  delete list;
+  delete[] table;
+};
+
+// one update at the head of a flow from generateFlow, rungs of the given width where each object links to the objects
+// at the same and the next position of the next rung, so there are two paths into every object after the first
+// rung, width 1 is a chain. Recursive push propagation against a runFlow pass over the schedule
+// push runs every path through the flow and recurses as deep as the flow, so it is left out of the large cases
+static void benchFlow() {
+  const uint32_t shapes[][2] = { { 100, 1 }, { 1000, 1 }, { 10000, 1 }, { 32, 2 }, { 40, 2 }, { 1000, 10 }, { 10000, 100 } };
+  printf("flow propagation\n");
+  printf("  %8s %6s %14s %14s %14s\n", "objects", "width", "us (push)", "us (runFlow)", "runs/pass");
+  for (uint32_t s = 0; s < sizeof(shapes)/sizeof(shapes[0]); s++) {
+    uint32_t objects = shapes[s][0];
+    uint32_t width = shapes[s][1];
+    FlowShape shape = { objects, 1, (width > 1 ? 2u : 1u), (objects + width - 1) / width };
+    InstanceTemplate* table = new InstanceTemplate[flowRows(shape)];
+    uint32_t rows = generateFlow(shape, table);
+    for (uint32_t row = 0; row < rows; row++) { // values from 0 with exact change detection, a push stops where a value arrives again
+      if (CurrentValueType == table[row].resourceTypeID) {
+        table[row].value.integerType = 0;
+      }
+      else if (DeadbandType == table[row].resourceTypeID) {
+        table[row].value.floatType = 0;
+      }
+    };
+    ObjectList* list = new ObjectList();
+    list -> buildInstances(table, rows);
+    list -> flowScheduled = true; // updates mark the Objects dirty for runFlow
+    Object* head = list -> getObjectByID(43000, 0);
+    uint32_t repeats = 10;
+
+    double pushUs = -1;
+    if (objects <= 1000 && (1 == width || objects / width <= 20)) {
+      list -> flowScheduled = false; // the handler of every update runs before updateDefaultValue returns
+      double start = nowNs();
+      for (uint32_t i = 0; i < repeats; i++) {
+        head -> updateDefaultValue((AnyValueType){ .integerType = (int)i });
+      };
+      pushUs = (nowNs() - start) / repeats / 1000;
+      list -> flowScheduled = true;
+    }
+
+    uint32_t runs = 0;
+    double start = nowNs();
+    for (uint32_t i = 0; i < repeats; i++) {
+      head -> updateDefaultValue((AnyValueType){ .integerType = (int)i });
+      runs = list -> runFlow();
+    };
+    double runUs = (nowNs() - start) / repeats / 1000;
+    if (pushUs < 0) {
+      printf("  %8u %6u %14s %14.1f %14u\n", objects, width, "-", runUs, runs);
+    }
+    else {
+      printf("  %8u %6u %14.1f %14.1f %14u\n", objects, width, pushUs, runUs, runs);
+    }
+    delete list;
+    delete[] table;
+  };
+};
+
+// a polled sensor pushing a float reading with noise of +-0.2 down a chain of TestObjects each tick, with 
+// change detection off (negative deadband), exact, and with a deadband of 0.5 that suppresses the noise
+static void benchChangeDetection() {
+  const uint32_t objects = 100;
+  const uint32_t ticks = 10000;
+  const double deadbands[] = { -1, 0, 0.5 };
+  printf("change detection, %u objects, float reading with +-0.2 noise\n", objects);
+  printf("  %10s %12s %14s %16s\n", "deadband", "us/tick", "runs/tick", "suppressed/tick");
+  for (uint32_t d = 0; d < sizeof(deadbands)/sizeof(double); d++) {
+    InstanceTemplate* table = new InstanceTemplate[objects * 3];
+    uint32_t rows = 0;
+    for (uint32_t n = 0; n < objects; n++) {
+      table[rows++] = (InstanceTemplate){ 43000, (uint16_t)n, CurrentValueType, 0, floatType, (AnyValueType){ .floatType = 0 } };
+      table[rows++] = (InstanceTemplate){ 43000, (uint16_t)n, DeadbandType, 0, floatType, (AnyValueType){ .floatType = deadbands[d] } };
+      if (n + 1 < objects) {
+        table[rows++] = (InstanceTemplate){ 43000, (uint16_t)n, OutputLinkType, 0, linkType, (AnyValueType){ .linkType = { 43000, (uint16_t)(n + 1) } } };
+      }
+    };
+    ObjectList* list = new ObjectList();
+    list -> buildInstances(table, rows);
+    list -> flowScheduled = true; // updates mark the Objects dirty for runFlow
+    Object* head = list -> getObjectByID(43000, 0);
+    uint32_t seed = 1;
+    uint64_t runs = 0;
+    double start = nowNs();
+    for (uint32_t tick = 0; tick < ticks; tick++) {
+      AnyValueType reading;
+      reading.floatType = 20.0 + ((int)(benchRandom(&seed) % 5) - 2) * 0.1;
+      head -> updateDefaultValue(reading);
+      runs += list -> runFlow();
+    };
+    double tickUs = (nowNs() - start) / ticks / 1000;
+    printf("  %10.1f %12.2f %14.1f %16.1f\n", deadbands[d], tickUs, (double)runs / ticks, (double)list -> suppressedUpdates() / ticks);
+    delete list;
+    delete[] table;
+  };
+};
+
+// cost of making string values, and a status label from a small set pushed down a chain of TestObjects each
+// tick, with every update a change (negative deadband, as strings were before handles) and compared by handle
+static void benchStrings() {
+  const char* labels[] = { "ok", "idle", "running", "stopped", "fault: overtemperature", "fault: no flow" };
+  const uint32_t labelCount = sizeof(labels) / sizeof(char*);
+  const uint32_t calls = 1000000;
+  uint32_t seed = 1;
+  uint32_t checksum = 0;
+  printf("string values, %u labels, %u interned\n", labelCount, internedStrings());
+  double start = nowNs();
+  for (uint32_t call = 0; call < calls; call++) {
+    checksum += stringValue(labels[call % labelCount]).bytes[0];
+  };
+  printf("  stringValue %.1f ns, inline up to %u characters\n", (nowNs() - start) / calls, inlineStringLength);
+  StringValue handles[labelCount];
+  for (uint32_t label = 0; label < labelCount; label++) {
+    handles[label] = stringValue(labels[label]);
+  };
+  start = nowNs();
+  for (uint32_t call = 0; call < calls; call++) {
+    checksum += sameString(handles[benchRandom(&seed) % labelCount], handles[4]);
+  };
+  double handleNs = (nowNs() - start) / calls;
+  start = nowNs();
+  for (uint32_t call = 0; call < calls; call++) {
+    checksum += (0 == strcmp(labels[benchRandom(&seed) % labelCount], labels[4]));
+  };
+  printf("  sameString %.1f ns, strcmp %.1f ns (checksum %u)\n", handleNs, (nowNs() - start) / calls, checksum);
+
+  const uint32_t objects = 100;
+  const uint32_t ticks = 10000;
+  const double deadbands[] = { -1, 0 };
+  printf("  %10s %12s %14s %16s\n", "deadband", "us/tick", "runs/tick", "suppressed/tick");
+  for (uint32_t d = 0; d < sizeof(deadbands)/sizeof(double); d++) {
+    InstanceTemplate* table = new InstanceTemplate[objects * 3];
+    uint32_t rows = 0;
+    for (uint32_t n = 0; n < objects; n++) {
+      table[rows++] = (InstanceTemplate){ 43000, (uint16_t)n, CurrentValueType, 0, stringType, (AnyValueType){ .stringType = stringLiteral(labels[0]) } };
+      table[rows++] = (InstanceTemplate){ 43000, (uint16_t)n, DeadbandType, 0, floatType, (AnyValueType){ .floatType = deadbands[d] } };
+      if (n + 1 < objects) {
+        table[rows++] = (InstanceTemplate){ 43000, (uint16_t)n, OutputLinkType, 0, linkType, (AnyValueType){ .linkType = { 43000, (uint16_t)(n + 1) } } };
+      }
+    };
+    ObjectList* list = new ObjectList();
+    list -> buildInstances(table, rows);
+    list -> flowScheduled = true; // updates mark the Objects dirty for runFlow
+    Object* head = list -> getObjectByID(43000, 0);
+    uint64_t runs = 0;
+    start = nowNs();
+    for (uint32_t tick = 0; tick < ticks; tick++) {
+      AnyValueType status;
+      status.stringType = handles[(tick / 16) % labelCount]; // the status changes every 16 ticks
+      head -> updateDefaultValue(status);
+      runs += list -> runFlow();
+    };
+    double tickUs = (nowNs() - start) / ticks / 1000;
+    printf("  %10.1f %12.2f %14.1f %16.1f\n", deadbands[d], tickUs, (double)runs / ticks, (double)list -> suppressedUpdates() / ticks);
+    delete list;
+    delete[] table;
+  };
+};
+
+// timed Objects with intervals of 100 to 10000 ticks, run each tick by calling updateCurrentTime on every Object
+// and by the timer heap of updateTimers, which only visits the Objects that are due
+static void benchTimers() {
+  const uint32_t sizes[] = { 100, 1000, 10000 };
+  const uint32_t ticks = 20000;
+  printf("timers, intervals 100..10000 ticks\n");
+  printf("  %8s %16s %16s %12s\n", "objects", "us/tick (scan)", "us/tick (heap)", "runs/tick");
+  for (uint32_t s = 0; s < sizeof(sizes)/sizeof(uint32_t); s++) {
+    uint32_t objects = sizes[s];
+    InstanceTemplate* table = new InstanceTemplate[objects * 3];
+    uint32_t rows = 0;
+    uint32_t seed = 1;
+    for (uint32_t n = 0; n < objects; n++) {
+      table[rows++] = (InstanceTemplate){ syntheticType(n), syntheticInstance(n), CurrentTimeType, 0, timeType, (AnyValueType){ .timeType = 0 } };
+      table[rows++] = (InstanceTemplate){ syntheticType(n), syntheticInstance(n), IntervalTimeType, 0, timeType,
+        (AnyValueType){ .timeType = 100 + benchRandom(&seed) % 9901 } };
+      table[rows++] = (InstanceTemplate){ syntheticType(n), syntheticInstance(n), LastActivationTimeType, 0, timeType, (AnyValueType){ .timeType = 0 } };
+    };
+    ObjectList* scan = new ObjectList();
+    scan -> buildInstances(table, rows);
+    double start = nowNs();
+    for (time_t tick = 1; tick <= ticks; tick++) {
+      for (Object* object = scan -> firstObject; object != NULL; object = object -> nextObject) {
+        object -> updateCurrentTime(tick);
+      };
+    };
+    double scanUs = (nowNs() - start) / ticks / 1000;
+    ObjectList* heap = new ObjectList();
+    heap -> buildInstances(table, rows);
+    heap -> buildTimers();
+    uint64_t runs = 0;
+    start = nowNs();
+    for (time_t tick = 1; tick <= ticks; tick++) {
+      runs += heap -> updateTimers(tick);
+    };
+    printf("  %8u %16.2f %16.3f %12.2f\n", objects, scanUs, (nowNs() - start) / ticks / 1000, (double)runs / ticks);
+    delete scan;
+    delete heap;
+    delete[] table;
+  };
+  // updateTimers against the updateCurrentTime scan over the time_t wrap, every 50th Object with IntervalTime 0
+  const uint32_t objects = 1000;
+  const time_t first = (time_t)0 - ticks / 2;
+  InstanceTemplate* table = new InstanceTemplate[objects * 3];
+  uint32_t rows = 0;
+  uint32_t seed = 1;
+  for (uint32_t n = 0; n < objects; n++) {
+    table[rows++] = (InstanceTemplate){ syntheticType(n), syntheticInstance(n), CurrentTimeType, 0, timeType, (AnyValueType){ .timeType = first } };
+    table[rows++] = (InstanceTemplate){ syntheticType(n), syntheticInstance(n), IntervalTimeType, 0, timeType,
+      (AnyValueType){ .timeType = (0 == n % 50 ? 0 : 100 + benchRandom(&seed) % 9901) } };
+    table[rows++] = (InstanceTemplate){ syntheticType(n), syntheticInstance(n), LastActivationTimeType, 0, timeType, (AnyValueType){ .timeType = first } };
+  };
+  ObjectList* scan = new ObjectList();
+  scan -> buildInstances(table, rows);
+  ObjectList* heap = new ObjectList();
+  heap -> buildInstances(table, rows);
+  uint64_t runs = 0;
+  uint32_t mismatches = 0;
+  for (time_t tick = first + 1; tick != first + 1 + ticks; tick++) {
+    uint32_t scanRuns = 0;
+    for (Object* object = scan -> firstObject; object != NULL; object = object -> nextObject) {
+      object -> updateCurrentTime(tick);
+      scanRuns += (object -> getResourceByID(LastActivationTimeType, 0) -> get<time_t>() == tick);
+    };
+    uint32_t heapRuns = heap -> updateTimers(tick);
+    runs += heapRuns;
+    mismatches += (scanRuns != heapRuns);
+  };
+  for (Object* object = scan -> firstObject, * other = heap -> firstObject; object != NULL && other != NULL;
+    object = object -> nextObject, other = other -> nextObject) {
+    mismatches += (object -> getResourceByID(LastActivationTimeType, 0) -> get<time_t>() != other -> getResourceByID(LastActivationTimeType, 0) -> get<time_t>());
+  };
+  printf("  wrap check, %u Objects, ticks %u..%u, %llu runs %s\n", objects, (uint32_t)(first + 1), (uint32_t)(first + ticks),
+    (unsigned long long)runs, mismatches != 0 ? "(mismatch)" : "");
+  delete scan;
+  delete heap;
+  delete[] table;
+};
+
+#ifdef OBJECTFLOW_EVENTLOOP
+// process CPU time in nanoseconds
+static double cpuNs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+};
+
+// timed Objects with intervals of 50..500 ms, last activated now
+static ObjectList* timedList(uint32_t objects, time_t now) {
+  InstanceTemplate* table = new InstanceTemplate[objects * 3];
+  uint32_t rows = 0;
+  uint32_t seed = 1;
+  for (uint32_t n = 0; n < objects; n++) {
+    table[rows++] = (InstanceTemplate){ syntheticType(n), syntheticInstance(n), CurrentTimeType, 0, timeType, (AnyValueType){ .timeType = now } };
+    table[rows++] = (InstanceTemplate){ syntheticType(n), syntheticInstance(n), IntervalTimeType, 0, timeType,
+      (AnyValueType){ .timeType = 50 + benchRandom(&seed) % 451 } };
+    table[rows++] = (InstanceTemplate){ syntheticType(n), syntheticInstance(n), LastActivationTimeType, 0, timeType, (AnyValueType){ .timeType = now } };
+  };
+  ObjectList* list = new ObjectList();
+  list -> buildInstances(table, rows);
+  delete[] table;
+  return list;
+};
+
+// CPU use and wake-up lateness of a host loop that polls updateTimers, one that ticks every millisecond, and the
+// FlowEventLoop sleeping until the next deadline, over the same timed Objects for the same wall time
+static void benchEventLoop() {
+  const double seconds = 2;
+  const uint32_t objects = 100;
+  printf("event loop, %u Objects, intervals 50..500 ms, %.0f s each\n", objects, seconds);
+  printf("  %10s %10s %10s %10s %14s %14s\n", "loop", "CPU %", "wakeups", "runs", "late us (avg)", "late us (max)");
+  for (uint32_t mode = 0; mode < 3; mode++) {
+    FlowEventLoop* loop = NULL;
+    ObjectList* list = timedList(objects, (time_t)(nowNs() / 1e6));
+    uint64_t wakeups = 0;
+    uint64_t runs = 0;
+    uint32_t timerWakeups = 0; // wake-ups that ran a due Object, for the average lateness
+    double totalLate = 0;
+    double maxLate = 0;
+    double cpuStart = cpuNs();
+    double start = nowNs();
+    if (2 == mode) {
+      loop = new FlowEventLoop(list);
+      while (nowNs() - start < seconds * 1e9) {
+        runs += loop -> runOnce();
+      };
+      wakeups = loop -> wakeups;
+      timerWakeups = loop -> wakeups;
+      totalLate = loop -> totalLateness;
+      maxLate = loop -> maxLateness;
+    }
+    else {
+      while (nowNs() - start < seconds * 1e9) {
+        if (1 == mode) {
+          struct timespec tick = { 0, 1000000 };
+          nanosleep(&tick, NULL);
+        }
+        time_t deadline;
+        bool timed = list -> nextDeadline(&deadline);
+        double now = nowNs();
+        uint32_t run = list -> updateTimers((time_t)(now / 1e6));
+        wakeups++;
+        if (run > 0 && timed) { // late by the time since the start of the deadline's millisecond
+          double late = (int32_t)((time_t)(now / 1e6) - deadline) * 1e3 + fmod(now, 1e6) / 1e3;
+          totalLate += late;
+          timerWakeups++;
+          if (late > maxLate) {
+            maxLate = late;
+          }
+        }
+        runs += run;
+      };
+    }
+    double wall = nowNs() - start;
+    const char* names[] = { "polling", "1 ms tick", "timerfd" };
+    printf("  %10s %10.2f %10llu %10llu %14.1f %14.1f\n", names[mode], 100 * (cpuNs() - cpuStart) / wall, 
+      (unsigned long long)wakeups, (unsigned long long)runs, (timerWakeups > 0 ? totalLate / timerWakeups : 0), maxLate);
+    delete loop;
+    delete list;
+  };
+  // the virtual clock runs the same timers without sleeping
+  ObjectList* list = timedList(objects, 0);
+  FlowEventLoop* loop = new FlowEventLoop(list);
+  loop -> virtualClock = true;
+  uint64_t runs = 0;
+  double start = nowNs();
+  while (loop -> virtualTime < (time_t)(seconds * 1000)) {
+    runs += loop -> runOnce();
+  };
+  printf("  virtual clock: %.0f s of timers in %.1f us, %u wakeups, %llu runs\n", seconds, (nowNs() - start) / 1e3, 
+    loop -> wakeups, (unsigned long long)runs);
+  delete loop;
+  delete list;
+};
+#endif
+
+#ifdef OBJECTFLOW_COMPILED_FLOW
+// a tick of a chain of TestObjects with a new value at the head, a ChainHead timed with IntervalTime 1, as in 
+// compiled-chain.py. The tick is run by updateTimers with the handlers' syncs, by updateTimers and runFlow, and 
+// by the compiled flow from the builder. The tail value is the last tick for each
+template <typename CompiledFlow> static void benchChain(uint16_t first, uint16_t length, uint32_t ticks) {
+  InstanceTemplate* table = new InstanceTemplate[length * 2 + 3];
+  uint32_t rows = 0;
+  for (uint16_t instance = first; instance < first + length; instance++) {
+    uint16_t type = (instance == first ? chainHeadType : 43000);
+    table[rows++] = (InstanceTemplate){ type, instance, CurrentValueType, 0, integerType, (AnyValueType){ .integerType = 0 } };
+    if (instance == first) {
+      table[rows++] = (InstanceTemplate){ type, instance, CurrentTimeType, 0, timeType, (AnyValueType){ .timeType = 0 } };
+      table[rows++] = (InstanceTemplate){ type, instance, IntervalTimeType, 0, timeType, (AnyValueType){ .timeType = 1 } };
+      table[rows++] = (InstanceTemplate){ type, instance, LastActivationTimeType, 0, timeType, (AnyValueType){ .timeType = 0 } };
+    }
+    if (instance + 1 < first + length) {
+      table[rows++] = (InstanceTemplate){ type, instance, OutputLinkType, 0, linkType, (AnyValueType){ .linkType = { 43000, (uint16_t)(instance + 1) } } };
+    }
+  };
+  double ns[3];
+  int tail[3];
+  for (uint32_t mode = 0; mode < 3; mode++) {
+    ObjectList* list = new ObjectList();
+    list -> addObject(new (list -> arena) ChainHead(chainHeadType, first, list -> firstObject)); // buildInstances adds its resources
+    list -> buildInstances(table, rows);
+    Resource* head = list -> getObjectByID(chainHeadType, first) -> getResourceByID(CurrentValueType, 0);
+    CompiledFlow flow;
+    list -> runFlow(); // schedule the flow
+    list -> flowScheduled = (mode != 0); // the push handlers run before updateDefaultValue returns
+    if (2 == mode && !flow.bind(list)) {
+      return;
+    }
+    double start = nowNs();
+    for (time_t tick = 1; tick <= ticks; tick++) {
+      head -> set<int>((int)tick);
+      if (2 == mode) {
+        flow.run(tick);
+      }
+      else {
+        list -> updateTimers(tick);
+        if (1 == mode) {
+          list -> runFlow();
+        }
+      }
+    };
+    ns[mode] = (nowNs() - start) / ticks;
+    tail[mode] = list -> getObjectByID(43000, first + length - 1) -> get<int>(CurrentValueType, 0);
+    delete list;
+  };
+  printf("  %8u %14.1f %14.1f %14.1f %10d %10d %10d\n", length, ns[0], ns[1], ns[2], tail[0], tail[1], tail[2]);
+  delete[] table;
+};
+
+static void benchCompiledFlow() {
+  printf("compiled flow, a tick of a timed chain\n");
+#ifdef OBJECTFLOW_STATIC_DISPATCH
+  printf("  ChainHead isn't in the static dispatch switches, build without OBJECTFLOW_STATIC_DISPATCH\n");
+#else
+  printf("  %8s %14s %14s %14s %10s %10s %10s\n", "objects", "ns (push)", "ns (runFlow)", "ns (compiled)", "tail", "tail", "tail");
+  benchChain<CompiledFlow_43100_0>(0, 4, 1000000);
+  benchChain<CompiledFlow_43100_100>(100, 32, 200000);
+#endif
+};
+#endif
+
+#ifdef OBJECTFLOW_THREADS
+// throughput of FlowPool passes over many independent chains of TestObjects (type 43000), for 1 to the number of cores threads
+// the checksum of the chain ends is the same for every thread count
+static void benchFlowPool() {
+  const uint32_t shapes[][2] = { { 1000, 20 }, { 200, 100 }, { 20, 1000 } }; // chains, objects per chain
+  uint32_t cores = (uint32_t)sysconf(_SC_NPROCESSORS_ONLN);
+  uint32_t maxThreads = (cores < 2 ? 2 : cores);
+  printf("FlowPool, %u cores\n", cores);
+  printf("  %8s %8s %8s %14s %14s %12s\n", "objects", "chains", "threads", "us/pass", "Mobjects/s", "checksum");
+  for (uint32_t s = 0; s < sizeof(shapes)/sizeof(shapes[0]); s++) {
+    uint32_t chains = shapes[s][0];
+    uint32_t length = shapes[s][1];
+    uint32_t objects = chains * length;
+    InstanceTemplate* table = new InstanceTemplate[objects * 2];
+    uint32_t rows = 0;
+    for (uint32_t n = 0; n < objects; n++) {
+      table[rows++] = (InstanceTemplate){ 43000, (uint16_t)n, CurrentValueType, 0, integerType, (AnyValueType){ .integerType = 0 } };
+      if ((n + 1) % length != 0) {
+        table[rows++] = (InstanceTemplate){ 43000, (uint16_t)n, OutputLinkType, 0, linkType, (AnyValueType){ .linkType = { 43000, (uint16_t)(n + 1) } } };
+      }
+    };
+    ObjectList* list = new ObjectList();
+    list -> buildInstances(table, rows);
+    list -> flowScheduled = true; // updates mark the Objects dirty for runFlow
+    Object** heads = new Object*[chains];
+    Object** ends = new Object*[chains];
+    for (uint32_t chain = 0; chain < chains; chain++) {
+      heads[chain] = list -> getObjectByID(43000, chain * length);
+      ends[chain] = list -> getObjectByID(43000, chain * length + length - 1);
+    };
+    for (uint32_t threads = 1; threads <= maxThreads; threads *= 2) {
+      FlowPool* pool = new FlowPool(list, threads);
+      uint32_t passes = 2000000 / objects + 10;
+      uint64_t runs = 0;
+      double start = nowNs();
+      for (uint32_t pass = 0; pass < passes; pass++) {
+        for (uint32_t chain = 0; chain < chains; chain++) {
+          heads[chain] -> updateDefaultValue((AnyValueType){ .integerType = (int)(pass * chains + chain) });
+        };
+        runs += pool -> runFlow();
+      };
+      double passNs = (nowNs() - start) / passes;
+      uint32_t checksum = 0;
+      for (uint32_t chain = 0; chain < chains; chain++) {
+        checksum = checksum * 31 + ends[chain] -> readDefaultValue().integerType;
+      };
+      printf("  %8u %8u %8u %14.1f %14.1f %12u\n", objects, chains, threads, passNs / 1000, runs / passes / passNs * 1000, checksum);
+      delete pool;
+      if (threads < maxThreads && threads * 2 > maxThreads) {
+        threads = maxThreads / 2; // the last step is the number of cores
+      }
+    };
+    delete[] heads;
+    delete[] ends;
+    delete list;
+    delete[] table;
+  };
+};
+#endif
+
+#ifdef OBJECTFLOW_SEQLOCK
+// stress of seqlocked values, reader threads use readValueByID while the flow thread uses updateValueByID
+// every value written has equal 32 bit halves, so a torn read shows as unequal halves
+struct SeqlockReader {
+  ObjectList* list;
+  uint32_t objects;
+  volatile bool* stop;
+  uint64_t reads;
+  uint64_t torn;
+  pthread_t thread;
+};
+
+static uint64_t valueBits(AnyValueType value) {
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+};
+
+static void* seqlockReader(void* argument) {
+  SeqlockReader* reader = (SeqlockReader*)argument;
+  uint32_t seed = (uint32_t)(uintptr_t)reader;
+  while (!*reader -> stop) {
+    for (uint32_t i = 0; i < 1000; i++) {
+      uint32_t n = benchRandom(&seed) % reader -> objects;
+      uint64_t bits = valueBits(reader -> list -> getObjectByID(syntheticType(n), syntheticInstance(n)) -> readValueByID(CurrentValueType, 0));
+      reader -> torn += ((uint32_t)bits != (uint32_t)(bits >> 32));
+    };
+    reader -> reads += 1000;
+  };
+  return NULL;
+};
+
+static void benchSeqlock() {
+  const uint32_t objects = 64;
+  const double seconds = 0.5;
+  InstanceTemplate* table = new InstanceTemplate[objects];
+  for (uint32_t n = 0; n < objects; n++) {
+    table[n] = (InstanceTemplate){ syntheticType(n), syntheticInstance(n), CurrentValueType, 0, floatType, (AnyValueType){ .floatType = 0 } };
+  };
+  ObjectList* list = new ObjectList();
+  list -> buildInstances(table, objects); // the structure is done before the readers start
+  Object** objectPointers = new Object*[objects];
+  for (uint32_t n = 0; n < objects; n++) {
+    objectPointers[n] = list -> getObjectByID(syntheticType(n), syntheticInstance(n));
+  };
+  printf("seqlock values, %u objects\n", objects);
+  printf("  %8s %14s %18s %12s\n", "readers", "Mwrites/s", "Mreads/s (each)", "torn reads");
+  const uint32_t readerCounts[] = { 0, 1, 2, 4 };
+  for (uint32_t r = 0; r < sizeof(readerCounts)/sizeof(uint32_t); r++) {
+    uint32_t readers = readerCounts[r];
+    volatile bool stop = false;
+    SeqlockReader* state = new SeqlockReader[readers + 1];
+    for (uint32_t reader = 0; reader < readers; reader++) {
+      state[reader] = (SeqlockReader){ .list = list, .objects = objects, .stop = &stop, .reads = 0, .torn = 0, .thread = pthread_t() };
+      pthread_create(&state[reader].thread, NULL, seqlockReader, &state[reader]);
+    };
+    uint64_t writes = 0;
+    double start = nowNs();
+    double end = start + seconds * 1e9;
+    while (nowNs() < end) {
+      for (uint32_t i = 0; i < 1000; i++) {
+        uint32_t k = (uint32_t)(writes + i);
+        uint64_t bits = ((uint64_t)k << 32) | k;
+        AnyValueType value;
+        memcpy(&value, &bits, sizeof(value));
+        objectPointers[k % objects] -> updateValueByID(CurrentValueType, 0, value);
+      };
+      writes += 1000;
+    };
+    double elapsed = nowNs() - start;
+    stop = true;
+    uint64_t reads = 0;
+    uint64_t torn = 0;
+    for (uint32_t reader = 0; reader < readers; reader++) {
+      pthread_join(state[reader].thread, NULL);
+      reads += state[reader].reads;
+      torn += state[reader].torn;
+    };
+    printf("  %8u %14.1f %18.1f %12lu\n", readers, writes / elapsed * 1000, (readers > 0 ? reads / readers / elapsed * 1000 : 0.0), (unsigned long)torn);
+    delete[] state;
+  };
+  delete[] objectPointers;
+  delete list;
+  delete[] table;
+};
+#endif
+
+#ifdef OBJECTFLOW_SNAPSHOT
+// snapshot of 100k integer resources, a journal write each tick with 1% of the values changed, and a restore
+// of the snapshot and journal into a new list built from the same table
+static void benchSnapshot() {
+  const uint32_t objects = 10000;
+  const uint32_t resources = 10;
+  const uint32_t ticks = 100;
+  const uint32_t changes = objects * resources / 100;
+  const char* snapshotFile = "/tmp/objectflow-bench.snapshot";
+  const char* journalFile = "/tmp/objectflow-bench.journal";
+  InstanceTemplate* table = resourceTable(objects, resources);
+  ObjectList* list = new ObjectList();
+  list -> buildInstances(table, objects * resources);
+  FlowSnapshot* snapshot = new FlowSnapshot(list, snapshotFile, journalFile);
+  printf("snapshot and journal, %u resources, %u changes per tick\n", objects * resources, changes);
+
+  double start = nowNs();
+  snapshot -> snapshot();
+  double snapshotMs = (nowNs() - start) / 1e6;
+  uint64_t snapshotBytes = snapshot -> bytesWritten;
+
+  uint32_t seed = 1;
+  uint32_t journaled = 0;
+  double journalNs = 0;
+  for (uint32_t tick = 0; tick < ticks; tick++) {
+    for (uint32_t change = 0; change < changes; change++) {
+      uint32_t n = benchRandom(&seed) % (objects * resources);
+      list -> getObjectByID(syntheticType(n / resources), syntheticInstance(n / resources)) -> getResourceByID(30000 + n % resources, 0) -> value.integerType += 1;
+    };
+    start = nowNs();
+    journaled += snapshot -> journalChanges();
+    journalNs += nowNs() - start;
+  };
+  uint64_t journalBytes = snapshot -> bytesWritten - snapshotBytes;
+
+  ObjectList* restored = new ObjectList();
+  restored -> buildInstances(table, objects * resources);
+  FlowSnapshot* reader = new FlowSnapshot(restored, snapshotFile, journalFile);
+  start = nowNs();
+  uint32_t applied = reader -> restore();
+  double restoreMs = (nowNs() - start) / 1e6;
+  uint32_t mismatches = 0;
+  for (Object* object = list -> firstObject, * other = restored -> firstObject; object != NULL; object = object -> nextObject, other = other -> nextObject) {
+    for (Resource* resource = object -> firstResource, * copy = other -> firstResource; resource != NULL; resource = resource -> nextResource, copy = copy -> nextResource) {
+      mismatches += (resource -> value.integerType != copy -> value.integerType);
+    };
+  };
+
+  printf("  snapshot %.1f ms, %lu bytes\n", snapshotMs, (unsigned long)snapshotBytes);
+  printf("  journal %.1f us per tick, %u changed values, %lu bytes, %.1f bytes written per changed value byte\n", journalNs / ticks / 1e3,
+    journaled, (unsigned long)journalBytes, (double)journalBytes / ((double)journaled * sizeof(AnyValueType)));
+  printf("  restore %.1f ms, %u values applied %s\n", restoreMs, applied, mismatches != 0 ? "(mismatch)" : "");
+  delete reader;
+  delete snapshot;
+  delete restored;
+  delete list;
+  delete[] table;
+  remove(snapshotFile);
+  remove(journalFile);
+};
+#endif
+
+// ValueMap Objects (type 43010) for a bank of 10 bit ADC channels, an integer or float InputValue from 0 to 1023
+static InstanceTemplate* valueMapTable(uint32_t channels, ValueType inputType, uint32_t* rows) {
+  InstanceTemplate* table = new InstanceTemplate[channels * 8];
+  *rows = 0;
+  for (uint32_t n = 0; n < channels; n++) {
+    uint16_t instance = (uint16_t)n;
+    AnyValueType input;
+    if (integerType == inputType) {
+      input.integerType = 0;
+    }
+    else {
+      input.floatType = 0;
+    }
+    double references[6] = { 0, 1023, -40.0 - n % 10, 125.0 + n % 50, -45, 150 }; // a temperature sensor, clamped near its range
+    table[(*rows)++] = (InstanceTemplate){ 43010, instance, InputValueType, 0, inputType, input };
+    table[(*rows)++] = (InstanceTemplate){ 43010, instance, CurrentValueType, 0, floatType, (AnyValueType){ .floatType = 0 } };
+    for (uint16_t reference = 0; reference < 6; reference++) {
+      table[(*rows)++] = (InstanceTemplate){ 43010, instance, (uint16_t)(InputLowReferenceType + reference), 0, floatType, 
+        (AnyValueType){ .floatType = references[reference] } };
+    };
+  };
+  return table;
+};
+
+// largest difference of the mapped values from the reference values
+static double largestError(const double* values, const double* reference, uint32_t count) {
+  double largest = 0;
+  for (uint32_t position = 0; position < count; position++) {
+    double difference = fabs(values[position] - reference[position]);
+    largest = (difference > largest ? difference : largest);
+  };
+  return largest;
+};
+
+// the map a handler would make on every call, reading the reference resources, as the model describes it
+static double perCallMap(Object* object, double input) {
+  double inputLow = object -> get<InputLowReferenceType>(0);
+  double inputHigh = object -> get<InputHighReferenceType>(0);
+  double currentLow = object -> get<CurrentLowReferenceType>(0);
+  double currentHigh = object -> get<CurrentHighReferenceType>(0);
+  double mapped = (input - inputLow) * (currentHigh - currentLow) / (inputHigh - inputLow) + currentLow;
+  double minimum = object -> get<CurrentValueMinimumType>(0);
+  double maximum = object -> get<CurrentValueMaximumType>(0);
+  return (mapped < minimum ? minimum : (mapped > maximum ? maximum : mapped));
+};
+
+// map 1000 channels of ADC samples with the per-call map, mapValue with the maps made once, ValueMap::mapInput,
+// which uses the table with OBJECTFLOW_VALUEMAP_TABLE, and the batch kernels, and through the ValueMap handler
+// and ValueMapBatch. The error is the largest difference from the per-call map, the maps are the same up to
+// rounding of the scale and offset
+static void benchValueMap() {
+  const uint32_t channels = 1000;
+  const uint32_t frames = 16; // sample frames, so each pass maps other inputs
+  const uint32_t sampleCount = frames * channels;
+  const uint32_t passes = 2000;
+#ifdef OBJECTFLOW_VALUEMAP_TABLE
+  const char* integerMap = "integer inputs mapped with a table";
+#else
+  const char* integerMap = "no tables";
+#endif
+  printf("ValueMap, %u channels, %s valuemap kernel, %s\n", channels, OBJECTFLOW_VALUEMAP_KERNEL, integerMap);
+  printf("  %-28s %12s %12s\n", "map", "ns/channel", "error");
+  uint32_t rows;
+  InstanceTemplate* table = valueMapTable(channels, integerType, &rows);
+  ObjectList* list = new ObjectList();
+  list -> buildInstances(table, rows);
+  list -> runFlow();
+  list -> flowScheduled = false; // push, the handler runs in updateDefaultValue
+  ValueMap** objects = new ValueMap*[channels];
+  LinearMap* maps = new LinearMap[channels];
+  double* scale = new double[channels];
+  double* offset = new double[channels];
+  double* minimum = new double[channels];
+  double* maximum = new double[channels];
+  for (uint32_t n = 0; n < channels; n++) {
+    objects[n] = static_cast<ValueMap*>(list -> getObjectByID(43010, (uint16_t)n));
+    objects[n] -> updateMap();
+    maps[n] = objects[n] -> map;
+    scale[n] = maps[n].scale;
+    offset[n] = maps[n].offset;
+    minimum[n] = maps[n].minimum;
+    maximum[n] = maps[n].maximum;
+  };
+  uint32_t state = 1;
+  int* counts = new int[sampleCount];
+  double* samples = new double[sampleCount];
+  double* expected = new double[sampleCount]; // per-call maps, for the error
+  double* expectedFloat = new double[sampleCount];
+  double* mapped = new double[sampleCount];
+  for (uint32_t sample = 0; sample < sampleCount; sample++) {
+    counts[sample] = (int)(benchRandom(&state) % 1024);
+    samples[sample] = counts[sample] + 0.25;
+    expected[sample] = perCallMap(objects[sample % channels], counts[sample]);
+    expectedFloat[sample] = perCallMap(objects[sample % channels], samples[sample]);
+  };
+  double checksum = 0;
+
+  double start = nowNs();
+  for (uint32_t pass = 0; pass < passes; pass++) {
+    double* frame = mapped + (pass % frames) * channels;
+    int* frameCounts = counts + (pass % frames) * channels;
+    for (uint32_t n = 0; n < channels; n++) {
+      frame[n] = perCallMap(objects[n], frameCounts[n]);
+    };
+    checksum += frame[pass % channels];
+  };
+  printf("  %-28s %12.2f %12.3g\n", "per-call, integer", (nowNs() - start) / passes / channels, largestError(mapped, expected, sampleCount));
+
+  start = nowNs();
+  for (uint32_t pass = 0; pass < passes; pass++) {
+    double* frame = mapped + (pass % frames) * channels;
+    int* frameCounts = counts + (pass % frames) * channels;
+    for (uint32_t n = 0; n < channels; n++) {
+      frame[n] = mapValue(maps[n], frameCounts[n]);
+    };
+    checksum += frame[pass % channels];
+  };
+  printf("  %-28s %12.2f %12.3g\n", "mapValue, integer", (nowNs() - start) / passes / channels, largestError(mapped, expected, sampleCount));
+
+  start = nowNs();
+  for (uint32_t pass = 0; pass < passes; pass++) {
+    double* frame = mapped + (pass % frames) * channels;
+    int* frameCounts = counts + (pass % frames) * channels;
+    for (uint32_t n = 0; n < channels; n++) {
+      frame[n] = objects[n] -> mapInput((AnyValueType){ .integerType = frameCounts[n] }, integerType);
+    };
+    checksum += frame[pass % channels];
+  };
+  printf("  %-28s %12.2f %12.3g\n", "mapInput, integer", (nowNs() - start) / passes / channels, largestError(mapped, expected, sampleCount));
+
+  start = nowNs();
+  for (uint32_t pass = 0; pass < passes; pass++) {
+    double* frame = mapped + (pass % frames) * channels;
+    double* frameSamples = samples + (pass % frames) * channels;
+    for (uint32_t n = 0; n < channels; n++) {
+      frame[n] = perCallMap(objects[n], frameSamples[n]);
+    };
+    checksum += frame[pass % channels];
+  };
+  printf("  %-28s %12.2f %12.3g\n", "per-call, float", (nowNs() - start) / passes / channels, largestError(mapped, expectedFloat, sampleCount));
+
+  start = nowNs();
+  for (uint32_t pass = 0; pass < passes; pass++) {
+    double* frame = mapped + (pass % frames) * channels;
+    double* frameSamples = samples + (pass % frames) * channels;
+    for (uint32_t n = 0; n < channels; n++) {
+      frame[n] = mapValue(maps[n], frameSamples[n]);
+    };
+    checksum += frame[pass % channels];
+  };
+  printf("  %-28s %12.2f %12.3g\n", "mapValue, float", (nowNs() - start) / passes / channels, largestError(mapped, expectedFloat, sampleCount));
+
+  start = nowNs();
+  for (uint32_t pass = 0; pass < passes; pass++) {
+    double* frame = mapped + (pass % frames) * channels;
+    mapChannels(scale, offset, minimum, maximum, samples + (pass % frames) * channels, frame, channels);
+    checksum += frame[pass % channels];
+  };
+  printf("  %-28s %12.2f %12.3g\n", "mapChannels, float", (nowNs() - start) / passes / channels, largestError(mapped, expectedFloat, sampleCount));
+
+  // the samples as a block of one channel, mapped with one map
+  start = nowNs();
+  for (uint32_t pass = 0; pass < passes; pass++) {
+    double* frame = mapped + (pass % frames) * channels;
+    mapValues(maps[0], samples + (pass % frames) * channels, frame, channels);
+    checksum += frame[pass % channels];
+  };
+  double blockNs = (nowNs() - start) / passes / channels;
+  for (uint32_t sample = 0; sample < sampleCount; sample++) {
+    expectedFloat[sample] = perCallMap(objects[0], samples[sample]);
+  };
+  printf("  %-28s %12.2f %12.3g\n", "mapValues, float", blockNs, largestError(mapped, expectedFloat, sampleCount));
+
+  // through the handler, the table maps the integer inputs
+  start = nowNs();
+  for (uint32_t pass = 0; pass < passes; pass++) {
+    int* frameCounts = counts + (pass % frames) * channels;
+    for (uint32_t n = 0; n < channels; n++) {
+      objects[n] -> updateDefaultValue((AnyValueType){ .integerType = frameCounts[n] });
+    };
+    checksum += objects[pass % channels] -> currentValue -> getValue().floatType;
+  };
+  double handlerNs = (nowNs() - start) / passes / channels;
+  uint32_t lastFrame = ((passes - 1) % frames) * channels;
+  for (uint32_t n = 0; n < channels; n++) {
+    mapped[n] = objects[n] -> currentValue -> getValue().floatType;
+  };
+  printf("  %-28s %12.2f %12.3g\n", "updateDefaultValue, integer", handlerNs, largestError(mapped, expected + lastFrame, channels));
+  delete list;
+  delete[] table;
+
+  // a bank of float channels mapped by ValueMapBatch, the inputs set as a driver would
+  table = valueMapTable(channels, floatType, &rows);
+  list = new ObjectList();
+  list -> buildInstances(table, rows);
+  for (uint32_t n = 0; n < channels; n++) {
+    objects[n] = static_cast<ValueMap*>(list -> getObjectByID(43010, (uint16_t)n));
+  };
+  ValueMapBatch* batch = new ValueMapBatch(objects, channels, list -> arena);
+  batch -> loadMaps();
+  start = nowNs();
+  for (uint32_t pass = 0; pass < passes; pass++) {
+    double* frameSamples = samples + (pass % frames) * channels;
+    for (uint32_t n = 0; n < channels; n++) {
+      objects[n] -> inputValue -> setValue((AnyValueType){ .floatType = frameSamples[n] });
+    };
+    batch -> update();
+    checksum += objects[pass % channels] -> currentValue -> getValue().floatType;
+  };
+  double batchNs = (nowNs() - start) / passes / channels;
+  for (uint32_t n = 0; n < channels; n++) {
+    expectedFloat[n] = perCallMap(objects[n], samples[lastFrame + n]);
+    mapped[n] = objects[n] -> currentValue -> getValue().floatType;
+  };
+  printf("  %-28s %12.2f %12.3g\n", "ValueMapBatch, float", batchNs, largestError(mapped, expectedFloat, channels));
+  printf("  checksum %.1f\n", checksum);
+  delete batch;
+  delete list;
+  delete[] table;
+  delete[] objects;
+  delete[] maps;
+  delete[] scale;
+  delete[] offset;
+  delete[] minimum;
+  delete[] maximum;
+  delete[] counts;
+  delete[] samples;
+  delete[] expected;
+  delete[] expectedFloat;
+  delete[] mapped;
+};
+
+int main() {
+  benchObjectLookup();
+  benchBuildInstances();
+  benchArena();
+  benchResourceStore();
+  benchBatchUpdate();
+  benchFlow();
+  benchChangeDetection();
+  benchStrings();
+  benchTimers();
+  benchValueMap();
+#ifdef OBJECTFLOW_EVENTLOOP
+  benchEventLoop();
+#endif
+#ifdef OBJECTFLOW_COMPILED_FLOW
+  benchCompiledFlow();
+#endif
+#ifdef OBJECTFLOW_THREADS
+  benchFlowPool();
+#endif
+#ifdef OBJECTFLOW_SEQLOCK
+  benchSeqlock();
+#endif
+#ifdef OBJECTFLOW_SNAPSHOT
+  benchSnapshot();
+#endif
+  return(0);
+};
@@ -0,0 +1,134 @@
+/* objectflow-suite times the hot ObjectFlow operations on synthetic flows and reports them as JSON lines */
+
+// objectflow-suite [objects resources fanout depth], without arguments a set of shapes is run
+// each line is one operation on one shape, e.g.
+// {"op": "getObjectByID", "objects": 10000, "resources": 8, "fanout": 2, "depth": 10, "ops": 1000000, "ns_per_op": 12.3, "ops_per_s": 81300813, 
+//  "dispatch": "virtual"}
+// build it with and without OBJECTFLOW_STATIC_DISPATCH to compare the handler calls
+
+#include <time.h>
+#include <stdlib.h>
+#include "../objectflow.h"
+#include "flowgen.h"
+
+using namespace ObjectFlow;
+
+// keeps results live so the timed loops aren't optimized away
+static volatile uintptr_t sink;
+
+#ifdef OBJECTFLOW_STATIC_DISPATCH
+static const char* dispatch = "static";
+#else
+static const char* dispatch = "virtual";
+#endif
+
+static void report(const char* op, const FlowShape& shape, uint32_t ops, double ns) {
+  double perOp = ns / ops;
+  printf("{\"op\": \"%s\", \"objects\": %u, \"resources\": %u, \"fanout\": %u, \"depth\": %u, \"ops\": %u, \"ns_per_op\": %.2f, \"ops_per_s\": %.0f, \"dispatch\": \"%s\"}\n",
+    op, shape.objects, shape.resources, shape.fanout, shape.depth, ops, perOp, 1e9 / perOp, dispatch);
+};
+
+static void runShape(const FlowShape& shape) {
+  InstanceTemplate* table = new InstanceTemplate[flowRows(shape)];
+  uint32_t rows = generateFlow(shape, table);
+  uint32_t width = flowWidth(shape);
+  const uint32_t lookups = 1000000;
+  uint32_t seed = 1;
+
+  // buildInstances, one op is one object with its resources and links
+  uint32_t builds = 1 + 200000 / shape.objects;
+  ObjectList* list = NULL;
+  double start = nowNs();
+  for (uint32_t build = 0; build < builds; build++) {
+    delete list;
+    list = new ObjectList();
+    list -> buildInstances(table, rows);
+  };
+  report("buildInstances", shape, builds * shape.objects, nowNs() - start);
+  list -> flowScheduled = true; // updates mark the objects dirty for runFlow
+
+  Object** objects = new Object*[shape.objects];
+  for (uint32_t n = 0; n < shape.objects; n++) {
+    objects[n] = list -> getObjectByID(43000, n);
+  };
+
+  start = nowNs();
+  for (uint32_t i = 0; i < lookups; i++) {
+    sink += (uintptr_t)list -> getObjectByID(43000, benchRandom(&seed) % shape.objects);
+  };
+  report("getObjectByID", shape, lookups, nowNs() - start);
+
+  start = nowNs();
+  for (uint32_t i = 0; i < lookups; i++) {
+    uint32_t r = benchRandom(&seed);
+    uint32_t resource = (r >> 16) % shape.resources;
+    sink += (uintptr_t)objects[r % shape.objects] -> getResourceByID(0 == resource ? CurrentValueType : 30000 + resource, 0);
+  };
+  report("getResourceByID", shape, lookups, nowNs() - start);
+
+  // the syncs write the default value and mark the objects dirty, the runFlow pass is timed on its own
+  if (shape.objects > width) {
+    start = nowNs();
+    for (uint32_t i = 0; i < lookups; i++) {
+      objects[width + benchRandom(&seed) % (shape.objects - width)] -> syncFromInputLink(); // objects with an InputLink
+    };
+    report("syncFromInputLink", shape, lookups, nowNs() - start);
+    list -> runFlow();
+
+    start = nowNs();
+    for (uint32_t i = 0; i < lookups; i++) {
+      objects[benchRandom(&seed) % (shape.objects - width)] -> syncToOutputLink(); // objects with OutputLinks
+    };
+    report("syncToOutputLink", shape, lookups, nowNs() - start);
+    list -> runFlow();
+  }
+
+  // one op is one object run by a pass that starts from every object of the first layer
+  uint32_t passes = 1 + 1000000 / shape.objects;
+  uint64_t runs = 0;
+  start = nowNs();
+  for (uint32_t pass = 0; pass < passes; pass++) {
+    for (uint32_t n = 0; n < width && n < shape.objects; n++) {
+      objects[n] -> updateDefaultValue((AnyValueType){ .integerType = (int)(pass + n) });
+    };
+    runs += list -> runFlow();
+  };
+  report("runFlow", shape, (uint32_t)runs, nowNs() - start);
+
+  // the interval is 10, so every tenth call activates onInterval
+  start = nowNs();
+  for (uint32_t i = 0; i < lookups; i++) {
+    objects[i % shape.objects] -> updateCurrentTime(i / shape.objects);
+  };
+  report("updateCurrentTime", shape, lookups, nowNs() - start);
+
+  delete[] objects;
+  delete list;
+  delete[] table;
+};
+
+int main(int argc, char** argv) {
+  if (5 == argc) {
+    FlowShape shape = { (uint32_t)atoi(argv[1]), (uint32_t)atoi(argv[2]), (uint32_t)atoi(argv[3]), (uint32_t)atoi(argv[4]) };
+    if (shape.objects < 1 || shape.objects > 65535 || shape.resources < 1 || shape.depth < 1 || shape.depth > shape.objects || shape.fanout > flowWidth(shape)) {
+      fprintf(stderr, "objects 1..65535, resources >= 1, depth 1..objects, fanout up to objects / depth\n");
+      return(1);
+    }
+    runShape(shape);
+    return(0);
+  }
+  if (argc != 1) {
+    fprintf(stderr, "usage: objectflow-suite [objects resources fanout depth]\n");
+    return(1);
+  }
+  const FlowShape shapes[] = {
+    { 100, 4, 1, 100 }, // chain
+    { 1000, 8, 1, 10 }, // parallel chains
+    { 10000, 8, 2, 10 }, // fan-out layers
+    { 60000, 4, 4, 100 },
+  };
+  for (uint32_t s = 0; s < sizeof(shapes)/sizeof(FlowShape); s++) {
+    runShape(shapes[s]);
+  };
+  return(0);
+};
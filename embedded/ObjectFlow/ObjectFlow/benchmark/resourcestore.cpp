@@ -0,0 +1,136 @@
+/* resourcestore is a struct-of-arrays storage of resources that objectflow-bench compares with the Resource lists */
+
+#include "../objectflow.h"
+#include "resourcestore.h"
+
+using namespace ObjectFlow;
+
+// construct an empty store
+ResourceStore::ResourceStore() {
+  keys = NULL;
+  valueTypes = NULL;
+  values = NULL;
+#ifdef OBJECTFLOW_SEQLOCK
+  sequences = NULL;
+#endif
+  resourceCount = 0;
+  objectTypeIDs = NULL;
+  objectInstanceIDs = NULL;
+  ranges = NULL;
+  objectCount = 0;
+  objectIndex = NULL;
+  objectIndexSize = 0;
+};
+
+// load the resources of an instance table, the rows of an object don't need to be adjacent
+// the first pass finds the objects and counts their resources, the second places each row in its object's range
+bool ResourceStore::build(const InstanceTemplate* templates, uint32_t count) {
+  freeResources();
+  objectIndexSize = 8;
+  while (objectIndexSize < count * 2) { // at most one object per row
+    objectIndexSize *= 2;
+  };
+  uint32_t* rowObjects = new uint32_t[count]; // object slot of each row
+  objectIndex = new (arena) uint32_t[objectIndexSize];
+  objectTypeIDs = new (arena) uint16_t[count];
+  objectInstanceIDs = new (arena) uint16_t[count];
+  ranges = new (arena) ResourceRange[count];
+  keys = new (arena) uint32_t[count];
+  valueTypes = new (arena) ValueType[count];
+  values = new (arena) AnyValueType[count];
+#ifdef OBJECTFLOW_SEQLOCK
+  sequences = new (arena) uint32_t[count];
+  bool sequencesMissing = (NULL == sequences);
+#else
+  bool sequencesMissing = false;
+#endif
+  if (NULL == objectIndex || NULL == objectTypeIDs || NULL == objectInstanceIDs || NULL == ranges || 
+    NULL == keys || NULL == valueTypes || NULL == values || sequencesMissing) {
+    printf("ResourceStore out of memory\n"); // the arena is full
+    delete[] rowObjects;
+    freeResources();
+    return false;
+  }
+  for (uint32_t slot = 0; slot < objectIndexSize; slot++) {
+    objectIndex[slot] = none;
+  };
+
+  for (uint32_t row = 0; row < count; row++) {
+    uint32_t object = findObject(templates[row].objectTypeID, templates[row].objectInstanceID);
+    if (none == object) { // new object, add it to the index
+      object = objectCount++;
+      objectTypeIDs[object] = templates[row].objectTypeID;
+      objectInstanceIDs[object] = templates[row].objectInstanceID;
+      ranges[object].count = 0;
+      uint32_t slot = objectIndexSlot(objectIndexKey(templates[row].objectTypeID, templates[row].objectInstanceID), objectIndexSize);
+      while (objectIndex[slot] != none) {
+        slot = (slot + 1) & (objectIndexSize - 1);
+      };
+      objectIndex[slot] = object;
+    }
+    ranges[object].count++;
+    rowObjects[row] = object;
+  };
+
+  uint32_t first = 0;
+  for (uint32_t object = 0; object < objectCount; object++) {
+    ranges[object].first = first;
+    first += ranges[object].count;
+    ranges[object].count = 0; // counts up again as the rows are placed
+  };
+
+  for (uint32_t row = 0; row < count; row++) {
+    ResourceRange* range = &ranges[rowObjects[row]];
+    uint32_t slot = range -> first + range -> count++;
+    keys[slot] = searchKey(templates[row].resourceTypeID, templates[row].resourceInstanceID);
+    valueTypes[slot] = templates[row].valueType;
+    values[slot] = templates[row].value;
+#ifdef OBJECTFLOW_SEQLOCK
+    sequences[slot] = 0;
+#endif
+  };
+  resourceCount = count;
+  delete[] rowObjects;
+  return true;
+};
+
+// free all arrays, leaving an empty store
+void ResourceStore::freeResources() {
+  arena.release();
+  keys = NULL;
+  valueTypes = NULL;
+  values = NULL;
+#ifdef OBJECTFLOW_SEQLOCK
+  sequences = NULL;
+#endif
+  resourceCount = 0;
+  objectTypeIDs = NULL;
+  objectInstanceIDs = NULL;
+  ranges = NULL;
+  objectCount = 0;
+  objectIndex = NULL;
+  objectIndexSize = 0;
+};
+
+// return the slot of the object with the type and instance
+uint32_t ResourceStore::findObject(uint16_t type, uint16_t instance) {
+  if (0 == objectIndexSize) {
+    return none;
+  }
+  uint32_t slot = objectIndexSlot(objectIndexKey(type, instance), objectIndexSize);
+  while (objectIndex[slot] != none) {
+    uint32_t object = objectIndex[slot];
+    if (objectTypeIDs[object] == type && objectInstanceIDs[object] == instance) {
+      return object;
+    }
+    slot = (slot + 1) & (objectIndexSize - 1);
+  };
+  return none;
+};
+
+// return the slot of the first resource of an object that matches the type and instance
+uint32_t ResourceStore::findResource(uint32_t objectSlot, uint16_t type, uint16_t instance) {
+  uint32_t first = ranges[objectSlot].first;
+  uint32_t position = findKey(keys + first, ranges[objectSlot].count, searchKey(type, instance));
+  return (position < ranges[objectSlot].count ? first + position : none);
+};
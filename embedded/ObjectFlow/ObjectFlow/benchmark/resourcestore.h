@@ -0,0 +1,71 @@
+/* resourcestore is a struct-of-arrays storage of resources that objectflow-bench compares with the Resource lists */
+
+namespace ObjectFlow
+
+{
+  /* 
+  ResourceStore is an alternative to the linked Resource lists of an ObjectList. The resources of all 
+  objects are kept in contiguous arrays, one per field, so a lookup scans a dense array of IDs and a 
+  pass over the values touches only the values. The resources of an object occupy a range of 
+  consecutive slots, and objects and resources are addressed by slot number after they are found. 
+  All arrays come from the store's arena and are freed together. The runtime doesn't use it, an Object finds
+  its resources through the dense key array that indexResources builds.
+  */
+
+  // resource slots of one object, first .. first + count - 1
+  struct ResourceRange {
+    uint32_t first;
+    uint16_t count;
+  };
+
+  class ResourceStore {
+    public:
+      // returned by the find functions when there is no match
+      static const uint32_t none = 0xFFFFFFFF;
+
+      // construct an empty store
+      ResourceStore();
+
+      Arena arena;
+
+      // resource fields, indexed by resource slot, keys are packed type and instance IDs for findKey
+      uint32_t* keys;
+      ValueType* valueTypes;
+      AnyValueType* values;
+#ifdef OBJECTFLOW_SEQLOCK
+      uint32_t* sequences; // seqlock of each value
+#endif
+      uint32_t resourceCount;
+
+      // object fields, indexed by object slot
+      uint16_t* objectTypeIDs;
+      uint16_t* objectInstanceIDs;
+      ResourceRange* ranges;
+      uint32_t objectCount;
+
+      // hash index of object slots, same keys and probing as the ObjectList index, none marks an empty slot
+      uint32_t* objectIndex;
+      uint32_t objectIndexSize;
+
+      // load the resources of an instance table, the rows of an object don't need to be adjacent
+      bool build(const InstanceTemplate* templates, uint32_t count);
+
+      // free all arrays, leaving an empty store
+      void freeResources();
+
+      // return the slot of the object with the type and instance
+      uint32_t findObject(uint16_t type, uint16_t instance);
+
+      // return the slot of the first resource of an object that matches the type and instance, using the keysearch kernel
+      uint32_t findResource(uint32_t objectSlot, uint16_t type, uint16_t instance);
+
+      // Value interfaces by slot
+#ifdef OBJECTFLOW_SEQLOCK
+      AnyValueType readValue(uint32_t resourceSlot) { return seqlockRead(&sequences[resourceSlot], &values[resourceSlot]); };
+      void updateValue(uint32_t resourceSlot, AnyValueType value) { seqlockWrite(&sequences[resourceSlot], &values[resourceSlot], value); };
+#else
+      AnyValueType readValue(uint32_t resourceSlot) { return values[resourceSlot]; };
+      void updateValue(uint32_t resourceSlot, AnyValueType value) { values[resourceSlot] = value; };
+#endif
+  };
+}
@@ -0,0 +1,146 @@
+/* eventloop runs the timers of an ObjectList without polling, for Linux hosts built with OBJECTFLOW_EVENTLOOP */
+
+#ifdef OBJECTFLOW_EVENTLOOP
+#include "objectflow.h"
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+using namespace ObjectFlow;
+
+// monotonic clock in nanoseconds
+static uint64_t monotonicNs() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + now.tv_nsec;
+};
+
+FlowEventLoop::FlowEventLoop(ObjectListBase* flowList) {
+  list = flowList;
+  sourceCount = 0;
+  stopping = false;
+  virtualClock = false;
+  virtualTime = 0;
+  wakeups = 0;
+  totalLateness = 0;
+  maxLateness = 0;
+  pollDescriptor = epoll_create1(EPOLL_CLOEXEC);
+  timerDescriptor = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  if (pollDescriptor < 0 || timerDescriptor < 0) {
+    printf("FlowEventLoop can't create epoll or timerfd\n");
+    return;
+  }
+  struct epoll_event event;
+  event.events = EPOLLIN;
+  event.data.fd = timerDescriptor;
+  epoll_ctl(pollDescriptor, EPOLL_CTL_ADD, timerDescriptor, &event);
+};
+
+FlowEventLoop::~FlowEventLoop() {
+  if (timerDescriptor >= 0) {
+    close(timerDescriptor);
+  }
+  if (pollDescriptor >= 0) {
+    close(pollDescriptor);
+  }
+};
+
+// the loop's time in milliseconds
+time_t FlowEventLoop::now() {
+  return (virtualClock ? virtualTime : (time_t)(monotonicNs() / 1000000u));
+};
+
+// call the handler when the descriptor is readable
+bool FlowEventLoop::addDescriptor(int descriptor, EventHandler handler, void* context) {
+  if (sourceCount >= maxEventSources || pollDescriptor < 0) {
+    printf("addDescriptor no room for the descriptor\n");
+    return false;
+  }
+  struct epoll_event event;
+  event.events = EPOLLIN;
+  event.data.fd = descriptor;
+  if (epoll_ctl(pollDescriptor, EPOLL_CTL_ADD, descriptor, &event) != 0) {
+    printf("addDescriptor can't add the descriptor\n");
+    return false;
+  }
+  sources[sourceCount++] = (EventSource){ descriptor, handler, context };
+  return true;
+};
+
+// wait for the next deadline or event, then run the due Objects
+uint32_t FlowEventLoop::runOnce() {
+  time_t deadline;
+  bool timed = list -> nextDeadline(&deadline);
+  if (virtualClock) { // no sleeping, the time moves to the deadline
+    if (!timed) {
+      stopping = true; // nothing left to simulate
+    }
+    else if ((int32_t)(deadline - virtualTime) > 0) {
+      virtualTime = deadline;
+    }
+    wakeups++;
+  }
+  else {
+    int timeout = -1; // no timed Objects, wait for an event
+    uint64_t deadlineNs = 0;
+    if (timed) {
+      uint64_t nowNs = monotonicNs();
+      int32_t remaining = (int32_t)(deadline - (time_t)(nowNs / 1000000u)); // wrap-safe, in milliseconds
+      if (remaining <= 0) {
+        timeout = 0; // already due
+      }
+      else { // absolute time of the millisecond the deadline starts
+        deadlineNs = (nowNs / 1000000u + remaining) * 1000000u;
+        struct itimerspec setting = {};
+        setting.it_value.tv_sec = deadlineNs / 1000000000u;
+        setting.it_value.tv_nsec = deadlineNs % 1000000000u;
+        timerfd_settime(timerDescriptor, TFD_TIMER_ABSTIME, &setting, NULL);
+      }
+    }
+    struct epoll_event events[maxEventSources + 1];
+    int ready = epoll_wait(pollDescriptor, events, maxEventSources + 1, timeout);
+    wakeups++;
+    if (deadlineNs != 0) {
+      uint64_t nowNs = monotonicNs();
+      if (nowNs >= deadlineNs) {
+        uint32_t lateness = (uint32_t)((nowNs - deadlineNs) / 1000u);
+        totalLateness += lateness;
+        if (lateness > maxLateness) {
+          maxLateness = lateness;
+        }
+      }
+    }
+    for (int event = 0; event < ready; event++) {
+      if (events[event].data.fd == timerDescriptor) {
+        uint64_t expirations;
+        if (read(timerDescriptor, &expirations, sizeof(expirations)) < 0) {
+          // spurious wake-up, the deadline is checked again below
+        }
+        continue;
+      }
+      for (uint32_t source = 0; source < sourceCount; source++) {
+        if (sources[source].descriptor == events[event].data.fd) {
+          sources[source].handler(this, sources[source].descriptor, sources[source].context);
+        }
+      };
+    };
+  }
+  uint32_t run = list -> updateTimers(now());
+  if (list -> flowScheduled) {
+    run += list -> runFlow();
+  }
+  return run;
+};
+
+// run until stop is called
+void FlowEventLoop::run() {
+  stopping = false;
+  while (!stopping) {
+    runOnce();
+  };
+};
+
+void FlowEventLoop::stop() {
+  stopping = true;
+};
+#endif
@@ -0,0 +1,67 @@
+/* eventloop runs the timers of an ObjectList without polling, for Linux hosts built with OBJECTFLOW_EVENTLOOP */
+
+#ifdef OBJECTFLOW_EVENTLOOP
+
+namespace ObjectFlow
+
+{
+  class FlowEventLoop;
+
+  // called when a descriptor added with addDescriptor is readable, the handler reads it and updates Objects
+  typedef void (*EventHandler)(FlowEventLoop* loop, int descriptor, void* context);
+
+  const uint32_t maxEventSources = 8;
+
+  struct EventSource {
+    int descriptor;
+    EventHandler handler;
+    void* context;
+  };
+
+  /*
+  A FlowEventLoop sleeps until the ObjectList's next timer deadline or an event on one of its descriptors,
+  instead of calling updateCurrentTime on a tick. The deadline comes from ObjectList::nextDeadline and arms a
+  timerfd on CLOCK_MONOTONIC, so the process isn't woken between deadlines. After each wake-up the due Objects
+  are run with updateTimers, then runFlow if the ObjectList is scheduled. Times are milliseconds of the
+  monotonic clock, which wrap with time_t as the timer heap allows. With a virtual clock the loop doesn't
+  sleep, the time jumps to the next deadline, for simulation and tests, and run stops when nothing is timed.
+  Objects with IntervalTime 0 don't set a deadline, so the loop doesn't spin on them, they are run by updateTimers
+  on every wake-up, at the deadlines of the other timed Objects and after events. Give an Object an interval to
+  run it at a rate.
+  */
+  class FlowEventLoop {
+    public:
+      FlowEventLoop(ObjectListBase* flowList);
+      ~FlowEventLoop();
+
+      ObjectListBase* list;
+      int pollDescriptor; // epoll instance, -1 if it couldn't be created
+      int timerDescriptor; // timerfd armed to the next deadline
+      EventSource sources[maxEventSources];
+      uint32_t sourceCount;
+      bool stopping;
+
+      bool virtualClock; // jump to the next deadline instead of sleeping
+      time_t virtualTime;
+
+      // wake-ups and how late the timer wake-ups were in microseconds
+      uint32_t wakeups;
+      uint64_t totalLateness;
+      uint32_t maxLateness;
+
+      // the loop's time in milliseconds, the monotonic clock or the virtual time
+      time_t now();
+
+      // call the handler when the descriptor is readable, returns false if there are already maxEventSources
+      bool addDescriptor(int descriptor, EventHandler handler, void* context);
+
+      // wait for the next deadline or event, then run the due Objects, returns the number of Objects run.
+      // Waits for an event with no timeout if there are no timed Objects
+      uint32_t runOnce();
+
+      // run until stop is called from a handler or an Object
+      void run();
+      void stop();
+  };
+}
+#endif
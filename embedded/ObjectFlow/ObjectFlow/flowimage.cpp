@@ -0,0 +1,225 @@
+/* flowimage loads the binary flow image made by the builder, for hosts built with OBJECTFLOW_IMAGE */
+
+#include "objectflow.h"
+
+#ifdef OBJECTFLOW_IMAGE
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace ObjectFlow;
+
+// check that the counts and offsets of an image header fit in the image, and that every index in the records
+// is in range, so a damaged image is reported instead of followed. Returns false if the image can't be used
+static bool checkImage(const uint8_t* base, uint32_t size) {
+  const FlowImageHeader* header = (const FlowImageHeader*)base;
+  if (size < sizeof(FlowImageHeader) || header -> magic != flowImageMagic) {
+    printf("not a flow image\n");
+    return false;
+  }
+  if (header -> byteOrder != flowImageByteOrder || header -> version != flowImageVersion || header -> headerSize != sizeof(FlowImageHeader)) {
+    printf("flow image version %d doesn't match this runtime\n", header -> version);
+    return false;
+  }
+  uint64_t objects = header -> objectCount;
+  uint64_t resources = header -> resourceCount;
+  if (header -> imageSize != size || 0 == objects || objects > 0x80000000u
+    || (uint64_t)header -> objectsOffset + objects * sizeof(FlowImageObject) > size
+    || (uint64_t)header -> resourcesOffset + resources * sizeof(FlowImageResource) > size
+    || (uint64_t)header -> keysOffset + resources * sizeof(uint32_t) > size
+    || (uint64_t)header -> outputsOffset + (uint64_t)header -> outputCount * sizeof(uint32_t) > size
+    || (uint64_t)header -> partitionsOffset + (uint64_t)header -> partitionCount * 2 * sizeof(uint32_t) > size
+    || (uint64_t)header -> poolOffset + header -> poolSize > size
+    || (header -> poolSize > 0 && base[header -> poolOffset + header -> poolSize - 1] != 0)
+    || ((header -> objectsOffset | header -> resourcesOffset | header -> keysOffset | header -> outputsOffset | header -> partitionsOffset) & 7) != 0) {
+    printf("flow image is truncated or damaged\n");
+    return false;
+  }
+  const FlowImageObject* objectRecords = (const FlowImageObject*)(base + header -> objectsOffset);
+  const FlowImageResource* resourceRecords = (const FlowImageResource*)(base + header -> resourcesOffset);
+  const uint32_t* outputs = (const uint32_t*)(base + header -> outputsOffset);
+  const uint32_t* partitions = (const uint32_t*)(base + header -> partitionsOffset);
+  for (uint32_t object = 0; object < objects; object++) {
+    const FlowImageObject* record = &objectRecords[object];
+    if ((uint64_t)record -> firstResource + record -> resourceCount > resources
+      || (uint64_t)record -> firstOutput + record -> outputCount > header -> outputCount
+      || (record -> inputObject != flowImageNone && record -> inputObject >= objects)
+      || record -> scheduleIndex >= objects || record -> partition >= header -> partitionCount) {
+      printf("flow image object [%d, %d] is damaged\n", record -> typeID, record -> instanceID);
+      return false;
+    }
+  };
+  for (uint32_t output = 0; output < header -> outputCount; output++) {
+    if (outputs[output] >= objects) {
+      printf("flow image output %d is damaged\n", output);
+      return false;
+    }
+  };
+  for (uint32_t resource = 0; resource < resources; resource++) {
+    const FlowImageResource* record = &resourceRecords[resource];
+    if (record -> valueType > timeType || (stringType == record -> valueType && (uint64_t)record -> value.timeType >= header -> poolSize)) {
+      printf("flow image resource [%d, %d] is damaged\n", record -> typeID, record -> instanceID);
+      return false;
+    }
+  };
+  for (uint32_t partition = 0; partition < header -> partitionCount; partition++) {
+    if ((uint64_t)partitions[2 * partition] + partitions[2 * partition + 1] > objects) {
+      printf("flow image partition %d is damaged\n", partition);
+      return false;
+    }
+  };
+  return true;
+};
+
+// build the flow in a binary flow image file made by the builder, see flowimage.h. The image is mapped
+// copy on write and kept until freeObjects, the Objects search its resource keys and string values are
+// made from its pool with stringValue. Links, the schedule and the partitions come from the image, so there are no lookups and
+// the flow is ready for runFlow. Returns the number of Objects, 0 if the image can't be loaded
+uint32_t ObjectListBase::loadImage(const char* path) {
+  if (firstObject != NULL) {
+    printf("loadImage needs an empty ObjectList\n");
+    return 0;
+  }
+  int file = open(path, O_RDONLY);
+  if (file < 0) {
+    printf("can't open flow image %s\n", path);
+    return 0;
+  }
+  struct stat status;
+  if (fstat(file, &status) != 0 || status.st_size < (off_t)sizeof(FlowImageHeader) || status.st_size > 0xFFFFFFFF) {
+    printf("flow image %s has no header\n", path);
+    close(file);
+    return 0;
+  }
+  uint32_t size = (uint32_t)status.st_size;
+  void* mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0); // writable so indexResources may reuse the keys
+  close(file);
+  if (MAP_FAILED == mapping) {
+    printf("can't map flow image %s\n", path);
+    return 0;
+  }
+  uint8_t* base = (uint8_t*)mapping;
+  if (!checkImage(base, size)) {
+    munmap(mapping, size);
+    return 0;
+  }
+  image = mapping;
+  imageSize = size;
+  const FlowImageHeader* header = (const FlowImageHeader*)base;
+  const FlowImageObject* objectRecords = (const FlowImageObject*)(base + header -> objectsOffset);
+  const FlowImageResource* resourceRecords = (const FlowImageResource*)(base + header -> resourcesOffset);
+  uint32_t* keys = (uint32_t*)(base + header -> keysOffset);
+  const uint32_t* outputs = (const uint32_t*)(base + header -> outputsOffset);
+  const uint32_t* imagePartitions = (const uint32_t*)(base + header -> partitionsOffset);
+  char* pool = (char*)(base + header -> poolOffset);
+  uint32_t objects = header -> objectCount;
+
+  // the arena holds everything but the index, schedule and partitions, sized as in buildInstances
+  arena.reserve(objects * (sizeof(Object) + 4 * sizeof(void*)) + header -> resourceCount * (sizeof(Resource) + sizeof(Resource*))
+    + header -> outputCount * sizeof(Object*));
+  indexSize = 8;
+  while (objects * 2 > indexSize) {
+    indexSize *= 2;
+  };
+  index = new ObjectIndexEntry[indexSize]; // sized for all Objects, so indexObject doesn't grow it
+  schedule = new Object*[objects];
+  partitions = new FlowPartition[header -> partitionCount];
+  Object** listed = new Object*[objects]; // Objects by image index, for the links
+  for (uint32_t slot = 0; slot < indexSize; slot++) {
+    index[slot].object = NULL;
+  };
+  for (uint32_t position = 0; position < objects; position++) {
+    schedule[position] = NULL;
+  };
+  indexStatic = false;
+  scheduleStatic = false;
+  scheduleCapacity = objects;
+  partitionCapacity = header -> partitionCount;
+
+  for (uint32_t position = 0; position < objects; position++) {
+    const FlowImageObject* record = &objectRecords[position];
+    Object* object = newObject(record -> typeID, record -> instanceID);
+    if (NULL == object || objectCount != position + 1 || schedule[record -> scheduleIndex] != NULL) {
+      printf("flow image object [%d, %d] is missing or repeated\n", record -> typeID, record -> instanceID);
+      delete[] listed;
+      freeObjects();
+      return 0;
+    }
+    listed[position] = object;
+    Resource** table = new (arena) Resource*[record -> resourceCount];
+    if (NULL == table) {
+      printf("loadImage out of memory\n");
+      delete[] listed;
+      freeObjects();
+      return 0;
+    }
+    for (uint32_t resource = 0; resource < record -> resourceCount; resource++) {
+      const FlowImageResource* resourceRecord = &resourceRecords[record -> firstResource + resource];
+      AnyValueType value = resourceRecord -> value;
+      if (stringType == resourceRecord -> valueType) {
+        value.stringType = stringValue(pool + resourceRecord -> value.timeType); // the offset is in the low 32 bits
+      }
+      table[resource] = object -> newResource(resourceRecord -> typeID, resourceRecord -> instanceID, (ValueType)resourceRecord -> valueType);
+      if (NULL == table[resource]) {
+        delete[] listed;
+        freeObjects();
+        return 0;
+      }
+      table[resource] -> setValue(value);
+      object -> callValueUpdate(resourceRecord -> typeID, resourceRecord -> instanceID, value); // as buildInstances does
+    };
+    object -> resourceKeys = &keys[record -> firstResource];
+    object -> resourceTable = table;
+    object -> resourceCount = record -> resourceCount;
+    object -> resourceCapacity = record -> resourceCount;
+    object -> resourcesIndexed = true;
+    object -> resolveDefaults();
+    object -> scheduleIndex = record -> scheduleIndex;
+    object -> partition = record -> partition;
+    schedule[record -> scheduleIndex] = object;
+  };
+  for (uint32_t position = 0; position < objects; position++) { // the links, now that every Object exists
+    const FlowImageObject* record = &objectRecords[position];
+    Object* object = listed[position];
+    object -> inputObject = (flowImageNone == record -> inputObject ? NULL : listed[record -> inputObject]);
+    object -> outputObjects = (0 == record -> outputCount ? NULL : new (arena) Object*[record -> outputCount]);
+    if (record -> outputCount > 0 && NULL == object -> outputObjects) {
+      printf("loadImage out of memory\n");
+      delete[] listed;
+      freeObjects();
+      return 0;
+    }
+    for (uint32_t output = 0; output < record -> outputCount; output++) {
+      object -> outputObjects[output] = listed[outputs[record -> firstOutput + output]];
+    };
+    object -> outputCount = record -> outputCount;
+    object -> outputCapacity = record -> outputCount;
+    object -> linksResolved = true;
+    object -> linkGeneration = linkGeneration;
+  };
+  delete[] listed;
+  partitionCount = header -> partitionCount;
+  for (uint32_t partition = 0; partition < partitionCount; partition++) {
+    FlowPartition* range = &partitions[partition];
+    range -> first = imagePartitions[2 * partition];
+    range -> count = imagePartitions[2 * partition + 1];
+    range -> dirtyFrom = range -> first + range -> count;
+    range -> runPosition = range -> first;
+    range -> running = false;
+  };
+  scheduleCount = objects;
+  scheduleValid = true;
+  return objects;
+};
+
+// unmap the flow image, called by freeObjects
+void ObjectListBase::releaseImage() {
+  if (image != NULL) {
+    munmap(image, imageSize);
+    image = NULL;
+    imageSize = 0;
+  }
+};
+
+#endif
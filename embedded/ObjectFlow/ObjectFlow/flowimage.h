@@ -0,0 +1,72 @@
+/* flowimage is the binary flow image made by the builder and loaded by ObjectList::loadImage, for hosts built with OBJECTFLOW_IMAGE */
+
+#ifdef OBJECTFLOW_IMAGE
+
+namespace ObjectFlow
+
+{
+  /*
+  A flow image holds the same flow as instances.h, in records that the loader uses where they are mapped, so
+  one runtime binary can load any flow without recompiling. The builder writes it with objectFlowImage(),
+  little endian with the layout below. Links, the flow schedule and its partitions are resolved by the builder,
+  and the packed resource keys are in the form getResourceByID searches, so the loader makes the Objects and
+  Resources without any lookups. Sections start on 8 byte boundaries at the offsets in the header.
+
+    FlowImageHeader
+    FlowImageObject[objectCount]       in list order
+    FlowImageResource[resourceCount]   grouped by Object in list order
+    uint32_t keys[resourceCount]       searchKey of each resource, used as the Objects' resourceKeys
+    uint32_t outputs[outputCount]      Object index of each OutputLink target, grouped by Object
+    uint32_t partitions[2 * partitionCount]  first schedule position and count of each partition
+    char pool[poolSize]                NUL terminated string values
+  */
+
+  const uint32_t flowImageMagic = 0x574C464F; // "OFLW"
+  const uint16_t flowImageVersion = 1;
+  const uint32_t flowImageByteOrder = 0x01020304; // reads differently on a host of the other byte order
+  const uint32_t flowImageNone = 0xFFFFFFFF; // no Object, e.g. for an Object with no InputLink
+
+  struct FlowImageHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize;
+    uint32_t byteOrder;
+    uint32_t imageSize;
+    uint32_t objectCount;
+    uint32_t resourceCount;
+    uint32_t outputCount;
+    uint32_t partitionCount;
+    uint32_t poolSize;
+    uint32_t objectsOffset;
+    uint32_t resourcesOffset;
+    uint32_t keysOffset;
+    uint32_t outputsOffset;
+    uint32_t partitionsOffset;
+    uint32_t poolOffset;
+    uint32_t reserved;
+  };
+
+  struct FlowImageObject {
+    uint16_t typeID;
+    uint16_t instanceID;
+    uint32_t firstResource; // index of the first resource record and key
+    uint32_t firstOutput; // index of the first output
+    uint32_t inputObject; // source Object of InputLink 0, flowImageNone if there is none
+    uint32_t scheduleIndex;
+    uint32_t partition;
+    uint16_t resourceCount;
+    uint16_t outputCount;
+    uint32_t reserved;
+  };
+
+  // the value is as in AnyValueType, except a string value is its offset in the pool
+  struct FlowImageResource {
+    uint16_t typeID;
+    uint16_t instanceID;
+    uint32_t valueType;
+    AnyValueType value;
+  };
+
+  static_assert(sizeof(FlowImageHeader) == 64 && sizeof(FlowImageObject) == 32 && sizeof(FlowImageResource) == 16, "flow image records are packed");
+}
+#endif
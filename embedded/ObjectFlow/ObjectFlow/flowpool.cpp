@@ -0,0 +1,168 @@
+/* flowpool runs the partitions of an ObjectList flow on a pool of threads, for hosts built with OBJECTFLOW_THREADS */
+
+#include "objectflow.h"
+
+#ifdef OBJECTFLOW_THREADS
+
+using namespace ObjectFlow;
+
+// worker thread, runs its queue for each pass until the pool stops
+static void* flowWorker(void* argument) {
+  FlowQueue* queue = (FlowQueue*)argument;
+  FlowPool* pool = queue -> pool;
+  uint32_t seen = 0; // generation when the pool started, a pass may be running before this thread gets here
+  pthread_mutex_lock(&pool -> mutex);
+  while (true) {
+    while (pool -> generation == seen && !pool -> stopping) {
+      pthread_cond_wait(&pool -> passStart, &pool -> mutex);
+    };
+    if (pool -> stopping) {
+      break;
+    }
+    seen = pool -> generation;
+    pthread_mutex_unlock(&pool -> mutex);
+    pool -> runQueue(queue);
+    pthread_mutex_lock(&pool -> mutex);
+    if (0 == --pool -> busy) {
+      pthread_cond_signal(&pool -> passDone);
+    }
+  };
+  pthread_mutex_unlock(&pool -> mutex);
+  return NULL;
+};
+
+// start threads - 1 worker threads for the flow of an ObjectList
+FlowPool::FlowPool(ObjectListBase* flowList, uint32_t threads) {
+  list = flowList;
+  threadCount = (0 == threads ? 1 : threads);
+  work = NULL;
+  workCapacity = 0;
+  generation = 0;
+  busy = 0;
+  stopping = false;
+  pthread_mutex_init(&mutex, NULL);
+  pthread_cond_init(&passStart, NULL);
+  pthread_cond_init(&passDone, NULL);
+  queues = new FlowQueue[threadCount];
+  for (uint32_t thread = 0; thread < threadCount; thread++) {
+    queues[thread].ends = 0;
+    queues[thread].runs = 0;
+    queues[thread].index = thread;
+    queues[thread].pool = this;
+    if (thread > 0 && pthread_create(&queues[thread].thread, NULL, flowWorker, &queues[thread]) != 0) {
+      printf("FlowPool couldn't start thread %d\n", thread);
+      threadCount = thread; // run with the threads that started
+      break;
+    }
+  };
+};
+
+// stop and join the workers
+FlowPool::~FlowPool() {
+  pthread_mutex_lock(&mutex);
+  stopping = true;
+  pthread_cond_broadcast(&passStart);
+  pthread_mutex_unlock(&mutex);
+  for (uint32_t thread = 1; thread < threadCount; thread++) {
+    pthread_join(queues[thread].thread, NULL);
+  };
+  delete[] queues;
+  delete[] work;
+  pthread_cond_destroy(&passDone);
+  pthread_cond_destroy(&passStart);
+  pthread_mutex_destroy(&mutex);
+};
+
+// run a pass over the dirty partitions with all threads, returns the number of Objects run
+// each queue starts with a contiguous range of the dirty partitions holding about an equal share of their Objects
+uint32_t FlowPool::runFlow() {
+  if (!list -> scheduleValid) {
+    list -> buildSchedule();
+    if (!list -> scheduleValid) {
+      return 0;
+    }
+  }
+  if (list -> partitionCount > workCapacity) {
+    delete[] work;
+    work = new uint32_t[list -> partitionCount];
+    workCapacity = list -> partitionCount;
+  }
+  uint32_t count = 0;
+  uint32_t objects = 0;
+  for (uint32_t partition = 0; partition < list -> partitionCount; partition++) {
+    FlowPartition* range = &list -> partitions[partition];
+    if (range -> dirtyFrom < range -> first + range -> count) {
+      work[count++] = partition;
+      objects += range -> first + range -> count - range -> dirtyFrom;
+    }
+  };
+  if (count < 2 || threadCount < 2) { // nothing to share
+    uint32_t run = 0;
+    for (uint32_t position = 0; position < count; position++) {
+      run += list -> runPartition(work[position]);
+    };
+    return run;
+  }
+  uint32_t position = 0;
+  uint64_t share = 0;
+  for (uint32_t thread = 0; thread < threadCount; thread++) {
+    uint32_t front = position;
+    uint64_t end = (uint64_t)objects * (thread + 1) / threadCount; // share of the Objects up to this queue
+    while (position < count && (share < end || thread == threadCount - 1)) {
+      FlowPartition* range = &list -> partitions[work[position++]];
+      share += range -> first + range -> count - range -> dirtyFrom;
+    };
+    queues[thread].ends = ((uint64_t)front << 32) | position;
+    queues[thread].runs = 0;
+  };
+  pthread_mutex_lock(&mutex);
+  generation++;
+  busy = threadCount - 1;
+  pthread_cond_broadcast(&passStart);
+  pthread_mutex_unlock(&mutex);
+  runQueue(&queues[0]);
+  pthread_mutex_lock(&mutex);
+  while (busy > 0) {
+    pthread_cond_wait(&passDone, &mutex);
+  };
+  pthread_mutex_unlock(&mutex);
+  uint32_t run = 0;
+  for (uint32_t thread = 0; thread < threadCount; thread++) {
+    run += queues[thread].runs;
+  };
+  return run;
+};
+
+// run the partitions of a queue, then steal from the other queues until none are left
+// no work is added during a pass, so a round of the other queues that finds nothing ends it
+void FlowPool::runQueue(FlowQueue* queue) {
+  uint32_t partition;
+  while (takeWork(queue, true, &partition)) {
+    queue -> runs += list -> runPartition(partition);
+  };
+  for (uint32_t victim = 1; victim < threadCount; victim++) {
+    FlowQueue* other = &queues[(queue -> index + victim) % threadCount];
+    while (takeWork(other, false, &partition)) {
+      queue -> runs += list -> runPartition(partition);
+    };
+  };
+};
+
+// claim the partition at the front or the back of a queue, returns false if the queue is empty
+bool FlowPool::takeWork(FlowQueue* queue, bool front, uint32_t* partition) {
+  uint64_t ends = __atomic_load_n(&queue -> ends, __ATOMIC_ACQUIRE);
+  while (true) {
+    uint32_t first = (uint32_t)(ends >> 32);
+    uint32_t last = (uint32_t)ends;
+    if (first >= last) {
+      return false;
+    }
+    uint64_t claimed = (front ? ((uint64_t)(first + 1) << 32) | last : ((uint64_t)first << 32) | (last - 1));
+    if (__atomic_compare_exchange_n(&queue -> ends, &ends, claimed, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+      *partition = work[front ? first : last - 1];
+      return true;
+    }
+  };
+};
+
+#endif
@@ -0,0 +1,59 @@
+/* flowpool runs the partitions of an ObjectList flow on a pool of threads, for hosts built with OBJECTFLOW_THREADS */
+
+#ifdef OBJECTFLOW_THREADS
+#include <pthread.h>
+
+namespace ObjectFlow
+
+{
+  class FlowPool;
+
+  /*
+  A FlowPool runs a pass of ObjectList::runFlow on several threads. The partitions of the schedule share no
+  links, so each dirty partition is run by one thread in schedule order, and the values at the end of a pass
+  are the same as for a single thread no matter which thread ran which partition. The calling thread takes
+  part in the pass. Handlers must only update Objects through their links while a pass is running, and must
+  not add Objects or change links.
+  */
+
+  // dirty partitions given to one thread for a pass, the owner takes from the front and idle threads steal
+  // from the back. Both ends are in one word so either end is claimed by a compare and swap
+  struct alignas(64) FlowQueue {
+    uint64_t ends; // (front << 32 | back) positions in the pool's work array
+    uint32_t runs; // Objects run by this thread in the pass
+    uint32_t index; // thread number, 0 is the calling thread
+    FlowPool* pool;
+    pthread_t thread;
+  };
+
+  class FlowPool {
+    public:
+      // start threads - 1 worker threads for the flow of an ObjectList
+      FlowPool(ObjectListBase* flowList, uint32_t threads);
+      // stop and join the workers
+      ~FlowPool();
+
+      ObjectListBase* list;
+      uint32_t threadCount;
+      FlowQueue* queues;
+      uint32_t* work; // dirty partitions of the current pass, split into a range for each queue
+      uint32_t workCapacity; // size of the work array
+
+      pthread_mutex_t mutex;
+      pthread_cond_t passStart; // signalled when a pass is ready for the workers
+      pthread_cond_t passDone; // signalled when the last worker is done
+      uint32_t generation; // pass number, workers wait for it to change
+      uint32_t busy; // workers still running the pass
+      bool stopping;
+
+      // run a pass over the dirty partitions with all threads, returns the number of Objects run
+      uint32_t runFlow();
+
+      // run the partitions of a queue, then steal from the other queues until none are left
+      void runQueue(FlowQueue* queue);
+
+      // claim the partition at the front or the back of a queue, returns false if the queue is empty
+      bool takeWork(FlowQueue* queue, bool front, uint32_t* partition);
+  };
+}
+#endif
@@ -1,19 +1,205 @@
 #include "objectflow.h"
 #include "handlers.h"
+#include <math.h>
 
 using namespace ObjectFlow;
 
 // Select an application Object based on its typeID
-Object* ObjectList::applicationObject(uint16_t type, uint16_t instance, Object* firstObject) {
+Object* ObjectListBase::applicationObject(uint16_t type, uint16_t instance, Object* firstObject) {
   switch (type) {
-    case 43000: return new TestObject(type, instance, firstObject);
-    default: return new Object(type, instance, firstObject);
+    case 43000: return new (arena) TestObject(type, instance, firstObject);
+    case 43010: return new (arena) ValueMap(type, instance, firstObject);
+    default: return new (arena) Object(type, instance, firstObject);
   }
 };
 
+#ifdef OBJECTFLOW_STATIC_DISPATCH
+// Call the handlers of the application Object selected by its typeID, as applicationObject does
+void Object::callValueUpdate(uint16_t type, uint16_t instance, AnyValueType value) {
+  switch (typeID) {
+    case 43000: return static_cast<TestObject*>(this) -> onValueUpdate(type, instance, value);
+    case 43010: return static_cast<ValueMap*>(this) -> onValueUpdate(type, instance, value);
+    default: return onValueUpdate(type, instance, value);
+  }
+};
+
+void Object::callValuesUpdate(Resource** resources, uint16_t count) {
+  switch (typeID) {
+    case 43000: return static_cast<TestObject*>(this) -> onValuesUpdate(resources, count);
+    case 43010: return static_cast<ValueMap*>(this) -> onValuesUpdate(resources, count);
+    default: return onValuesUpdate(resources, count);
+  }
+};
+
+void Object::callInterval() {
+  switch (typeID) {
+    case 43000: return static_cast<TestObject*>(this) -> onInterval();
+    case 43010: return static_cast<ValueMap*>(this) -> onInterval();
+    default: return onInterval();
+  }
+};
+
+void Object::callDefaultValueUpdate() {
+  switch (typeID) {
+    case 43000: return static_cast<TestObject*>(this) -> onDefaultValueUpdate();
+    case 43010: return static_cast<ValueMap*>(this) -> onDefaultValueUpdate();
+    default: return onDefaultValueUpdate();
+  }
+};
+
+AnyValueType Object::callInputSync() {
+  switch (typeID) {
+    case 43000: return static_cast<TestObject*>(this) -> onInputSync();
+    case 43010: return static_cast<ValueMap*>(this) -> onInputSync();
+    default: return onInputSync();
+  }
+};
+#endif
+
 TestObject::TestObject(uint16_t type, uint16_t instance, Object* listFirstObject) : Object(type, instance, listFirstObject){}; // constructor calls the base class constructor, could initialize additional state
 
 void TestObject::onDefaultValueUpdate() {
   syncToOutputLink();
 };
 
+
+ValueMap::ValueMap(uint16_t type, uint16_t instance, Object* listFirstObject) : Object(type, instance, listFirstObject){};
+
+// read a reference resource as a double, it may be an integer resource
+static bool referenceValue(Object* object, uint16_t type, double* value) {
+  Resource* resource = object -> getResourceByID(type, 0);
+  if (NULL == resource) {
+    return false;
+  }
+  AnyValueType any = resource -> getValue();
+  *value = (integerType == resource -> valueType ? any.integerType : any.floatType);
+  return true;
+};
+
+// make the map and the table from the reference resources
+bool ValueMap::updateMap() {
+  double inputLow, inputHigh, currentLow, currentHigh, minimum, maximum;
+  inputValue = getResourceByID(InputValueType, 0);
+  currentValue = getResourceByID(CurrentValueType, 0);
+  if (NULL == inputValue || NULL == currentValue || 
+      !referenceValue(this, InputLowReferenceType, &inputLow) || !referenceValue(this, InputHighReferenceType, &inputHigh) ||
+      !referenceValue(this, CurrentLowReferenceType, &currentLow) || !referenceValue(this, CurrentHighReferenceType, &currentHigh) ||
+      !referenceValue(this, CurrentValueMinimumType, &minimum) || !referenceValue(this, CurrentValueMaximumType, &maximum)) {
+    printf("ValueMap [%d, %d] is missing a resource\n", typeID, instanceID);
+    return false;
+  }
+  map = linearMap(inputLow, inputHigh, currentLow, currentHigh, minimum, maximum);
+  mapValid = true;
+  tableSize = 0; // mapInput uses mapValue until the table is made
+#ifdef OBJECTFLOW_VALUEMAP_TABLE
+  if (integerType != inputValue -> valueType) {
+    return true;
+  }
+  double first = (inputLow < inputHigh ? inputLow : inputHigh);
+  double last = (inputLow < inputHigh ? inputHigh : inputLow);
+  if (!(last - first < maxValueMapTable) || first < -2147483648.0 || last > 2147483647.0) { // no table for a wide range
+    return true;
+  }
+  tableFirst = (int)ceil(first);
+  uint16_t size = (uint16_t)((int)floor(last) - tableFirst + 1);
+  if (size > tableCapacity) { // reserveTable didn't see this range, mapped with mapValue
+    return true;
+  }
+  for (uint16_t position = 0; position < size; position++) {
+    table[position] = mapValue(map, tableFirst + position);
+  };
+  tableSize = size;
+#endif
+  return true;
+};
+
+// allocate a table for the input range from the arena, before the handlers run, so updateMap doesn't allocate
+// while partitions of the flow run on other threads. Without an ObjectList there is no table
+void ValueMap::reserveTable() {
+#ifdef OBJECTFLOW_VALUEMAP_TABLE
+  double inputLow, inputHigh;
+  if (NULL == objectList || !referenceValue(this, InputLowReferenceType, &inputLow) || !referenceValue(this, InputHighReferenceType, &inputHigh)) {
+    return; // the range isn't set yet
+  }
+  Resource* input = getResourceByID(InputValueType, 0);
+  double first = (inputLow < inputHigh ? inputLow : inputHigh);
+  double last = (inputLow < inputHigh ? inputHigh : inputLow);
+  if ((input != NULL && integerType != input -> valueType) || !(last - first < maxValueMapTable) || first < -2147483648.0 || last > 2147483647.0) {
+    return;
+  }
+  uint16_t size = (uint16_t)((int)floor(last) - (int)ceil(first) + 1);
+  if (size > tableCapacity) { // the table is reused when it is big enough, outgrown tables are freed with the arena
+    double* grown = (double*)objectList -> arena.allocate(size * sizeof(double));
+    if (NULL == grown) {
+      printf("ValueMap table out of memory\n");
+      return; // mapped with mapValue
+    }
+    table = grown;
+    tableCapacity = size;
+  }
+#endif
+};
+
+// a reference changed, make the map again on the next update
+void ValueMap::onValueUpdate(uint16_t type, uint16_t instance, AnyValueType value) {
+  if (type >= InputLowReferenceType && type <= CurrentValueMaximumType) {
+    mapValid = false;
+    if (InputLowReferenceType == type || InputHighReferenceType == type) {
+      reserveTable();
+    }
+  }
+};
+
+void ValueMap::onDefaultValueUpdate() {
+  if (!mapValid && !updateMap()) {
+    return;
+  }
+  AnyValueType mapped;
+  mapped.floatType = mapInput(inputValue -> getValue(), inputValue -> valueType);
+  currentValue -> setValue(mapped);
+  syncToOutputLink();
+};
+
+ValueMapBatch::ValueMapBatch(ValueMap** mapObjects, uint32_t count, ArenaBase& arena) {
+  objects = mapObjects;
+  objectCount = count;
+  scale = (double*)arena.allocate(count * sizeof(double));
+  offset = (double*)arena.allocate(count * sizeof(double));
+  minimum = (double*)arena.allocate(count * sizeof(double));
+  maximum = (double*)arena.allocate(count * sizeof(double));
+  values = (double*)arena.allocate(count * sizeof(double));
+  if (NULL == scale || NULL == offset || NULL == minimum || NULL == maximum || NULL == values) {
+    printf("ValueMapBatch out of memory\n");
+    objectCount = 0;
+  }
+};
+
+// copy the maps of the Objects
+bool ValueMapBatch::loadMaps() {
+  for (uint32_t object = 0; object < objectCount; object++) {
+    ValueMap* valueMap = objects[object];
+    if (!valueMap -> mapValid && !valueMap -> updateMap()) {
+      return false;
+    }
+    scale[object] = valueMap -> map.scale;
+    offset[object] = valueMap -> map.offset;
+    minimum[object] = valueMap -> map.minimum;
+    maximum[object] = valueMap -> map.maximum;
+  };
+  return true;
+};
+
+// map the InputValues to the CurrentValues
+void ValueMapBatch::update() {
+  for (uint32_t object = 0; object < objectCount; object++) { // gather the inputs
+    Resource* input = objects[object] -> inputValue;
+    AnyValueType value = input -> getValue();
+    values[object] = (integerType == input -> valueType ? value.integerType : value.floatType);
+  };
+  mapChannels(scale, offset, minimum, maximum, values, values, objectCount);
+  for (uint32_t object = 0; object < objectCount; object++) { // scatter the mapped values
+    AnyValueType mapped;
+    mapped.floatType = values[object];
+    objects[object] -> currentValue -> setValue(mapped);
+  };
+};
@@ -1,8 +1,94 @@
+// Reference points and limits of the ValueMap Object type
+#define InputLowReferenceType 27008
+#define InputHighReferenceType 27009
+#define CurrentLowReferenceType 27010
+#define CurrentHighReferenceType 27011
+#define CurrentValueMinimumType 27012
+#define CurrentValueMaximumType 27013
+
 namespace ObjectFlow
 {
+  template <> struct ResourceTraits<InputLowReferenceType> { typedef double type; };
+  template <> struct ResourceTraits<InputHighReferenceType> { typedef double type; };
+  template <> struct ResourceTraits<CurrentLowReferenceType> { typedef double type; };
+  template <> struct ResourceTraits<CurrentHighReferenceType> { typedef double type; };
+  template <> struct ResourceTraits<CurrentValueMinimumType> { typedef double type; };
+  template <> struct ResourceTraits<CurrentValueMaximumType> { typedef double type; };
+
   class TestObject: public Object {
     public:
       TestObject(uint16_t type, uint16_t instance, Object* listFirstObject);   
+      constexpr TestObject(const ObjectInit& init) : Object(init) {}; // for statically initialized graphs
       void onDefaultValueUpdate();
   };
-}
\ No newline at end of file
+
+  // largest integer input range that ValueMap maps through a table, a 10 bit ADC
+  const uint32_t maxValueMapTable = 1024;
+
+  /*
+  ValueMap maps InputValue to CurrentValue through the reference points, (InputLowReference, CurrentLowReference)
+  and (InputHighReference, CurrentHighReference), and clamps it to CurrentValueMinimum and CurrentValueMaximum.
+  The map is made from the reference resources on first use and again after onValueUpdate on one of them.
+  With OBJECTFLOW_VALUEMAP_TABLE an integer InputValue whose reference range has at most maxValueMapTable values,
+  as from an ADC, is mapped with a table made with the map, see valuemap.h. Other inputs are mapped with mapValue. Call invalidateMap after setting the
+  reference resources without updateValueByID, for example by restoring a snapshot.
+  */
+  class ValueMap: public Object {
+    public:
+      ValueMap(uint16_t type, uint16_t instance, Object* listFirstObject);   
+      constexpr ValueMap(const ObjectInit& init) : Object(init) {};
+
+      LinearMap map = {};
+      Resource* inputValue = NULL;
+      Resource* currentValue = NULL;
+      double* table = NULL; // mapped values of the integer inputs from tableFirst, in the arena
+      int tableFirst = 0;
+      uint16_t tableSize = 0;
+      uint16_t tableCapacity = 0; // size of the table array
+      bool mapValid = false;
+
+      // make the map and the table from the reference resources, returns false if a resource is missing
+      bool updateMap();
+      // allocate the table when the input range is set, called by onValueUpdate
+      void reserveTable();
+      void invalidateMap() { mapValid = false; };
+
+      // the mapped value of an input, through the table if it is in range
+      double mapInput(AnyValueType value, ValueType valueType) {
+        if (integerType == valueType) {
+          uint32_t position = (uint32_t)value.integerType - (uint32_t)tableFirst; // below tableFirst wraps out of range
+          return (position < tableSize ? table[position] : mapValue(map, value.integerType));
+        }
+        return mapValue(map, value.floatType);
+      };
+
+      void onValueUpdate(uint16_t type, uint16_t instance, AnyValueType value);
+      void onDefaultValueUpdate();
+  };
+
+  /*
+  ValueMapBatch maps the InputValues of many ValueMap Objects at once with the mapChannels kernel, for a host
+  that samples a bank of channels together, and writes their CurrentValues. The maps are copied to arrays of
+  their fields, call loadMaps again after the reference resources change. The outputs aren't synced, the
+  caller syncs the Objects or runs the flow.
+  */
+  class ValueMapBatch {
+    public:
+      // the arrays are allocated from the arena
+      ValueMapBatch(ValueMap** mapObjects, uint32_t count, ArenaBase& arena);
+
+      ValueMap** objects;
+      uint32_t objectCount; // 0 if there was no memory for the arrays
+      double* scale;
+      double* offset;
+      double* minimum;
+      double* maximum;
+      double* values; // the inputs, then the mapped values
+      
+      // copy the maps of the Objects, returns false if one has no map, and update mustn't be called then
+      bool loadMaps();
+
+      // map the InputValues to the CurrentValues
+      void update();
+  };
+}
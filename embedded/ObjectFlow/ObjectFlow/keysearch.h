@@ -0,0 +1,69 @@
+/* keysearch finds a packed (type, instance) key in a contiguous array of keys */
+
+/*
+The kernel is chosen at compile time for the target: AVX2 compares 8 keys per instruction, SSE2 and 
+NEON compare 4, and the scalar loop is used on other targets and for the remainder. Define 
+OBJECTFLOW_SCALAR_KEYSEARCH to use the scalar loop everywhere.
+*/
+
+#if !defined(OBJECTFLOW_SCALAR_KEYSEARCH) && defined(__AVX2__)
+#include <immintrin.h>
+#define OBJECTFLOW_KEYSEARCH_KERNEL "avx2"
+#elif !defined(OBJECTFLOW_SCALAR_KEYSEARCH) && defined(__SSE2__)
+#include <emmintrin.h>
+#define OBJECTFLOW_KEYSEARCH_KERNEL "sse2"
+#elif !defined(OBJECTFLOW_SCALAR_KEYSEARCH) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define OBJECTFLOW_KEYSEARCH_KERNEL "neon"
+#else
+#define OBJECTFLOW_KEYSEARCH_KERNEL "scalar"
+#endif
+
+namespace ObjectFlow
+
+{
+  // key of a resource type and instance, in the same form as the object index keys
+  inline uint32_t searchKey(uint16_t type, uint16_t instance) {
+    return ((uint32_t)type << 16) | instance;
+  };
+
+  // return the position of the first key that matches, or count if there is none
+  inline uint32_t findKey(const uint32_t* keys, uint32_t count, uint32_t key) {
+    uint32_t position = 0;
+#if !defined(OBJECTFLOW_SCALAR_KEYSEARCH) && defined(__AVX2__)
+    __m256i key8 = _mm256_set1_epi32((int)key);
+    for (; position + 8 <= count; position += 8) {
+      __m256i match = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(keys + position)), key8);
+      int mask = _mm256_movemask_ps(_mm256_castsi256_ps(match)); // one bit per key
+      if (mask != 0) {
+        return position + __builtin_ctz(mask);
+      }
+    };
+#endif
+#if !defined(OBJECTFLOW_SCALAR_KEYSEARCH) && defined(__SSE2__)
+    __m128i key4 = _mm_set1_epi32((int)key);
+    for (; position + 4 <= count; position += 4) {
+      __m128i match = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(keys + position)), key4);
+      int mask = _mm_movemask_ps(_mm_castsi128_ps(match));
+      if (mask != 0) {
+        return position + __builtin_ctz(mask);
+      }
+    };
+#elif !defined(OBJECTFLOW_SCALAR_KEYSEARCH) && defined(__ARM_NEON)
+    uint32x4_t key4 = vdupq_n_u32(key);
+    for (; position + 4 <= count; position += 4) {
+      uint16x4_t match = vmovn_u32(vceqq_u32(vld1q_u32(keys + position), key4)); // 16 bits per key
+      uint64_t mask = vget_lane_u64(vreinterpret_u64_u16(match), 0);
+      if (mask != 0) {
+        return position + (__builtin_ctzll(mask) >> 4);
+      }
+    };
+#endif
+    for (; position < count; position++) {
+      if (keys[position] == key) {
+        return position;
+      }
+    };
+    return count;
+  };
+}
@@ -2,9 +2,21 @@
 
 using namespace ObjectFlow;
 
-int main() {
+int main(int argc, char** argv) {
+#ifdef OBJECTFLOW_STATIC_GRAPH
+  ObjectListBase& rtu = staticObjectList; // built by the compiler from static-instances.h
+#else
   ObjectList rtu;
+#ifdef OBJECTFLOW_IMAGE
+  if (argc > 1) { // objectflow-test flow-image, a binary flow image from the builder
+    if (0 == rtu.loadImage(argv[1])) {
+      return(1);
+    }
+  }
+  else
+#endif
   rtu.buildInstances();
+#endif
   rtu.displayObjects();
   printf ("\n");
   rtu.getObjectByID(43000,0) -> syncFromInputLink();
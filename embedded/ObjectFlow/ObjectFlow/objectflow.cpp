@@ -3,6 +3,9 @@
 #include "objectflow.h"
 #include "instances.h"
 #include "handlers.h"
+#ifdef OBJECTFLOW_STATIC_GRAPH
+#include "static-instances.h"
+#endif
 
 using namespace ObjectFlow;
 
@@ -22,33 +25,72 @@ Object::Object(uint16_t type, uint16_t instance, Object* listFirstObject) {
       typeID = type;
       instanceID = instance;
       firstResource = NULL;
+      lastResource = NULL;
       nextObject = NULL;
+      objectList = NULL;
+      defaultSource = NULL;
+      defaultDestination = NULL;
+      deadband = NULL;
+      defaultsResolved = false;
+      suppressedCount = 0;
+      inputObject = NULL;
+      outputObjects = NULL;
+      outputCount = 0;
+      outputCapacity = 0;
+      linksResolved = false;
+      resourceKeys = NULL;
+      resourceTable = NULL;
+      resourceCount = 0;
+      resourceCapacity = 0;
+      resourcesIndexed = false;
+      scheduleIndex = 0;
+      partition = 0;
+      dirty = false;
       // if listFirstObject is NULL, that means I am firstObject
       firstObject = (NULL==listFirstObject?this:listFirstObject);
 };   
 
 // Interface to create a new resource in this object
 Resource* Object::newResource(uint16_t type, uint16_t instance, ValueType vtype) {
-  // find last resource in the chain
+  defaultsResolved = false; // the new resource may outrank the current default resources
+  linksResolved = false; // or may be a link
+  resourcesIndexed = false;
+  if (objectList != NULL && (InputLinkType == type || OutputLinkType == type)) {
+    objectList -> scheduleValid = false; // the new link changes the flow order
+  }
+  if (objectList != NULL && (CurrentTimeType == type || IntervalTimeType == type || LastActivationTimeType == type)) {
+    objectList -> timersValid = false; // the Object may become timed
+  }
+  Resource* resource = (objectList != NULL ? new (objectList -> arena) Resource(type, instance, vtype ) : new Resource(type, instance, vtype ));
+  if (NULL == resource) {
+    printf("newResource out of memory\n");
+    return NULL;
+  }
   if (NULL == firstResource) { // make first resource instance in the list and add to this object
-    this -> firstResource = new Resource(type, instance, vtype );
-    return firstResource;
+    this -> firstResource = resource;
   }
-  else { // already have first resource
-    Resource* resource = firstResource;
-      while (resource -> nextResource != NULL) {
-        resource = resource -> nextResource;
-      };
-    // make instance and add the new resource to the list
-    resource -> nextResource = new Resource(type, instance, vtype );
-    return resource -> nextResource;
+  else { // already have first resource, append to the last one
+    lastResource -> nextResource = resource;
   };
+  lastResource = resource;
+  return resource;
 };
 
 // Interfaces to select Resources and Objects by their IDs
 
 // return a pointer to the first resource in this object that matches the type and instance
 Resource* Object::getResourceByID(uint16_t type, uint16_t instance) {
+#ifndef OBJECTFLOW_NO_RESOURCE_INDEX
+#ifndef OBJECTFLOW_SEQLOCK // with the seqlock reader threads get here too, they search the list until the writer has built the index
+  if (!resourcesIndexed) {
+    indexResources();
+  }
+#endif
+  if (resourcesIndexed) { // search the packed keys, the list is the fallback if there was no memory for them
+    uint32_t position = findKey(resourceKeys, resourceCount, searchKey(type, instance));
+    return (position < resourceCount ? resourceTable[position] : NULL); // returns NULL if resource doesn't exist
+  }
+#endif
   Resource* resource = firstResource;
   while ( (resource != NULL) && (resource -> typeID != type || resource -> instanceID != instance) ) {
     resource = resource -> nextResource;
@@ -56,9 +98,49 @@ Resource* Object::getResourceByID(uint16_t type, uint16_t instance) {
   return resource; // returns NULL if resource doesn't exist
 };
 
+// build the resourceKeys and resourceTable arrays from the resource list
+void Object::indexResources() {
+#ifndef OBJECTFLOW_NO_RESOURCE_INDEX
+  uint16_t count = 0;
+  for (Resource* resource = firstResource; resource != NULL; resource = resource -> nextResource) {
+    count++;
+  };
+  if (count > resourceCapacity) { // the arrays are reused when they are big enough
+    if (objectList != NULL) { // allocate from the arena, outgrown arrays are freed with the arena
+      resourceKeys = new (objectList -> arena) uint32_t[count];
+      resourceTable = new (objectList -> arena) Resource*[count];
+    }
+    else {
+      delete[] resourceKeys;
+      delete[] resourceTable;
+      resourceKeys = new uint32_t[count];
+      resourceTable = new Resource*[count];
+    }
+    if (NULL == resourceKeys || NULL == resourceTable) {
+      printf("indexResources out of memory\n");
+      resourceKeys = NULL;
+      resourceTable = NULL;
+      resourceCapacity = 0;
+      resourceCount = 0;
+      return; // getResourceByID searches the list
+    }
+    resourceCapacity = count;
+  }
+  resourceCount = 0;
+  for (Resource* resource = firstResource; resource != NULL; resource = resource -> nextResource) {
+    resourceKeys[resourceCount] = searchKey(resource -> typeID, resource -> instanceID);
+    resourceTable[resourceCount++] = resource;
+  };
+  resourcesIndexed = true;
+#endif
+};
+
 // return a pointer to the first object in the Object list that matches the type and instance
 Object* Object::getObjectByID(uint16_t type, uint16_t instance) {
-  Object* object = firstObject;
+  if (objectList != NULL) { // use the ObjectList index
+    return objectList -> getObjectByID(type, instance);
+  }
+  Object* object = firstObject; // not in an ObjectList, scan the chain
   while (object != NULL && (object -> typeID != type || object -> instanceID != instance)) {
     object = object -> nextObject;
   };
@@ -70,10 +152,15 @@ Object* Object::getObjectByID(uint16_t type, uint16_t instance) {
 // Interface to Read Value
 
 AnyValueType Object::readValueByID(uint16_t type, uint16_t instance) {
+#ifdef OBJECTFLOW_STATS
+  if (StatisticsType == type) { // virtual resource
+    return readStatistics(instance);
+  }
+#endif
   Resource* resource = getResourceByID(type, instance);
   AnyValueType returnValue;
   if (resource != NULL) {
-    return resource -> value;
+    return resource -> getValue();
   }
   else {
     printf ("NULL in readValueByID\n"); // should throw an error
@@ -86,8 +173,17 @@ AnyValueType Object::readValueByID(uint16_t type, uint16_t instance) {
 void Object::updateValueByID(uint16_t type, uint16_t instance, AnyValueType value) {
   Resource* resource = getResourceByID(type, instance);
   if (resource != NULL) {
-    resource -> value = value;
-  onValueUpdate(type, instance, value); // call the update handler
+    resource -> setValue(value);
+    if (InputLinkType == type || OutputLinkType == type) {
+      linksResolved = false; // link target changed
+      if (objectList != NULL) {
+        objectList -> scheduleValid = false;
+      }
+    }
+    if ((IntervalTimeType == type || LastActivationTimeType == type) && objectList != NULL) {
+      objectList -> rescheduleTimer(this); // next due time changed
+    }
+  callValueUpdate(type, instance, value); // call the update handler
   }
   else {
     printf("NULL in updateValueByID\n");
@@ -97,6 +193,35 @@ void Object::updateValueByID(uint16_t type, uint16_t instance, AnyValueType valu
 // Application logic extends this method
 void Object::onValueUpdate(uint16_t type, uint16_t instance, AnyValueType value) {}; 
 
+// Application logic may override this to handle a batch in one call
+void Object::onValuesUpdate(Resource** resources, uint16_t count) {
+  for (uint16_t resource = 0; resource < count; resource++) {
+    callValueUpdate(resources[resource] -> typeID, resources[resource] -> instanceID, resources[resource] -> getValue());
+  };
+};
+
+#ifdef OBJECTFLOW_STATS
+// value of a field of the handler statistics, the instance is statisticsInstance(handler, field)
+AnyValueType Object::readStatistics(uint16_t instance) {
+  AnyValueType value;
+  value.floatType = 0;
+  uint16_t handler = instance / statisticsFields;
+  uint16_t field = instance % statisticsFields;
+  if (handler >= statHandlerCount) {
+    printf("no Statistics instance %d\n", instance);
+    return value;
+  }
+  HandlerStatistics* handlerStatistics = &statistics.handler[handler];
+  value.floatType = (0 == field ? handlerStatistics -> calls : (1 == field ? handlerStatistics -> time : handlerStatistics -> histogram[field - 2]));
+  return value;
+};
+
+// clear the handler statistics
+void Object::resetStatistics() {
+  statistics = (ObjectStatistics){};
+};
+#endif
+
 /* 
 
 Flow Extension to the basic object model
@@ -133,14 +258,26 @@ CurrentValue   ==|   (no CurrentValue)
 
 */
 
+// the links were resolved after the last newObject of the list, a dangling link may have a target in a newer Object
+static inline bool linksCurrent(Object* object) {
+  return object -> linksResolved && (NULL == object -> objectList || object -> linkGeneration == object -> objectList -> linkGeneration);
+};
+
 // Copy Value from input link => this Object 
 void Object::syncFromInputLink() {
   // readDefaultValue from InputLink
   // updateDefaultValue on this object
-  Resource* inputLink = getResourceByID(InputLinkType,0);
-  if (inputLink != NULL) {
-    Object* sourceObject = getObjectByID(inputLink -> value.linkType.typeID, inputLink -> value.linkType.instanceID);
-    updateDefaultValue(sourceObject -> onInputSync()); // call onInputSync of the source object to get dynamic values and update the local default value
+  OBJECTFLOW_STATISTICS_SCOPE(this, statSyncFromInput);
+  if (!linksCurrent(this)) {
+    resolveLinks();
+  }
+  if (inputObject != NULL) {
+    AnyValueType value;
+    {
+      OBJECTFLOW_STATISTICS_SCOPE(inputObject, statInputSync);
+      value = inputObject -> callInputSync(); // call onInputSync of the source object to get dynamic values
+    }
+    updateDefaultValue(value); // and update the local default value
   }
 }; 
 
@@ -148,31 +285,83 @@ void Object::syncFromInputLink() {
 void Object::syncToOutputLink() {
   // readDefaultValue from this object
   // updateDefaultValue to OutputLink(s)
+#ifdef OBJECTFLOW_COMPILED_FLOW
+  if (objectList != NULL && objectList -> linksCompiled) { // the compiled flow copies the values along the links
+    synced = true;
+    return;
+  }
+#endif
+  OBJECTFLOW_STATISTICS_SCOPE(this, statSyncToOutput);
+  if (!linksCurrent(this)) {
+    resolveLinks();
+  }
   AnyValueType value = readDefaultValue();
+  for (uint16_t output = 0; output < outputCount; output++) { // process all output links
+    outputObjects[output] -> updateDefaultValue(value);
+  };
+}; 
+
+// resolve the link resources to Object pointers, returns the number of dangling links
+// dangling links are reported here and left out, so the sync functions never see them
+uint16_t Object::resolveLinks() {
+  uint16_t dangling = 0;
+  uint16_t links = 0;
   Resource* resource = firstResource;
-    while ( (resource != NULL) ) {
-      if (OutputLinkType == resource -> typeID) { // process all output links
-        Object* object = getObjectByID(resource -> value.linkType.typeID, resource -> value.linkType.instanceID);
-        object -> updateDefaultValue(value);
-      };
+  while (resource != NULL) { // count the output links to size the target array
+    if (OutputLinkType == resource -> typeID) {
+      links++;
+    }
     resource = resource -> nextResource;
-  }; 
+  };
+  if (links > outputCapacity) { // the array is reused when the links are resolved again
+    if (objectList != NULL) { // allocate from the arena, an outgrown array is freed with the arena
+      outputObjects = new (objectList -> arena) Object*[links];
+    }
+    else {
+      delete[] outputObjects;
+      outputObjects = new Object*[links];
+    }
+    if (NULL == outputObjects) {
+      printf("resolveLinks out of memory\n");
+      outputCapacity = 0;
+      outputCount = 0;
+      return links; // unresolved, tried again on the next sync
+    }
+    outputCapacity = links;
+  }
+  outputCount = 0;
+  inputObject = NULL;
+  resource = firstResource;
+  while (resource != NULL) {
+    if (OutputLinkType == resource -> typeID || (InputLinkType == resource -> typeID && 0 == resource -> instanceID)) {
+      Object* object = getObjectByID(resource -> value.linkType.typeID, resource -> value.linkType.instanceID);
+      if (NULL == object) {
+        printf("dangling link [%d, %d] [%d, %d] => [%d, %d]\n", typeID, instanceID, resource -> typeID, resource -> instanceID, 
+          resource -> value.linkType.typeID, resource -> value.linkType.instanceID);
+        dangling++;
+      }
+      else if (OutputLinkType == resource -> typeID) {
+        outputObjects[outputCount++] = object;
+      }
+      else {
+        inputObject = object;
+      }
+    }
+    resource = resource -> nextResource;
+  };
+  linksResolved = true;
+  linkGeneration = (objectList != NULL ? objectList -> linkGeneration : 0);
+  return dangling;
 }; 
 
 // extended interface for default value sync
 AnyValueType Object::readDefaultValue() {
   AnyValueType returnValue;
-  Resource* resource = getResourceByID(OutputValueType,0);
-  if (resource != NULL) {
-    return(resource -> value);
+  if (!defaultsResolved) {
+    resolveDefaults();
   }
-  resource = getResourceByID(CurrentValueType,0);
-  if (resource != NULL) {
-    return(resource -> value);
-  }
-  resource = getResourceByID(InputValueType,0);
-  if (resource != NULL) {
-    return(resource -> value);
+  if (defaultSource != NULL) {
+    return(defaultSource -> getValue());
   }
   printf("readDefault couldn't find a candidate resource\n"); // should throw an error
   return(returnValue); // returns uninitialized value union if there is no candidate
@@ -181,29 +370,67 @@ AnyValueType Object::readDefaultValue() {
 // extended interface for default value sync
 void Object::updateDefaultValue(AnyValueType value) {
   // prioritized resource types, update value and call onUpdate
-  Resource* resource = getResourceByID(InputValueType,0);
-  if (resource != NULL) {
-    resource -> value = value;
-    //onValueUpdate(resource -> typeID, resource -> instanceID, value);
-    onDefaultValueUpdate();
-    return;
-  };
-  resource = getResourceByID(CurrentValueType,0);
-  if (resource != NULL) {
-    resource -> value = value;
-    onDefaultValueUpdate();
-    return;
-  };
-  resource = getResourceByID(OutputValueType,0);
-  if (resource != NULL){
-    resource -> value = value;
-    onDefaultValueUpdate();
+  if (!defaultsResolved) {
+    resolveDefaults();
+  }
+  if (defaultDestination != NULL) {
+    if (!valueChanged(defaultDestination, value)) { // nothing to propagate
+      suppressedCount++;
+      return;
+    }
+    defaultDestination -> setValue(value);
+    //onValueUpdate(defaultDestination -> typeID, defaultDestination -> instanceID, value);
+    if (objectList != NULL && objectList -> flowScheduled) { // the handler is run by runFlow in link order
+      objectList -> markDirty(this);
+      return;
+    }
+    OBJECTFLOW_STATISTICS_SCOPE(this, statDefaultValueUpdate);
+    callDefaultValueUpdate();
     return;
   };
   printf("updateDefaultValue couldn't find a candidate resource\n"); // should throw an error
   return;
 }; 
 
+// select the default source and destination resources by priority ranking
+// the selection only changes when resources are added, so it is kept until the next newResource
+void Object::resolveDefaults() {
+  Resource* outputValue = getResourceByID(OutputValueType,0);
+  Resource* currentValue = getResourceByID(CurrentValueType,0);
+  Resource* inputValue = getResourceByID(InputValueType,0);
+  defaultSource = (outputValue != NULL ? outputValue : (currentValue != NULL ? currentValue : inputValue));
+  defaultDestination = (inputValue != NULL ? inputValue : (currentValue != NULL ? currentValue : outputValue));
+  deadband = getResourceByID(DeadbandType, 0);
+  defaultsResolved = true;
+}; 
+
+// compare a new value with the value of a resource by its value type, exact except for float values, which 
+// change when they differ by more than the deadband (0 if there is no Deadband resource). A negative deadband 
+// makes every update a change, for Objects that are triggered by updates. Strings are compared by handle
+bool Object::valueChanged(Resource* resource, AnyValueType value) {
+  double band = 0;
+  if (deadband != NULL) {
+    AnyValueType deadbandValue = deadband -> getValue();
+    band = (integerType == deadband -> valueType ? deadbandValue.integerType : deadbandValue.floatType);
+    if (band < 0) {
+      return true;
+    }
+  }
+  AnyValueType current = resource -> getValue();
+  switch (resource -> valueType) {
+    case booleanType: return current.booleanType != value.booleanType;
+    case integerType: return current.integerType != value.integerType;
+    case floatType: {
+      double delta = value.floatType - current.floatType;
+      return !(delta <= band && -delta <= band); // NaN is a change
+    }
+    case linkType: return current.linkType.typeID != value.linkType.typeID || current.linkType.instanceID != value.linkType.instanceID;
+    case timeType: return current.timeType != value.timeType;
+    case stringType: return !sameString(current.stringType, value.stringType);
+    default: return true;
+  }
+}; 
+
 /* 
 Timer extension
 */
@@ -215,12 +442,177 @@ void Object::updateCurrentTime(time_t timeValue) {
   Resource* currentTime = getResourceByID(CurrentTimeType, 0);
   Resource* intervalTime = getResourceByID(IntervalTimeType, 0);
   Resource* lastActivationTime = getResourceByID(LastActivationTimeType, 0);
-  currentTime -> value.timeType = timeValue;
-  if (timeValue - lastActivationTime -> value.timeType >= intervalTime -> value.timeType) {
-    lastActivationTime -> value.timeType = timeValue;
-    onInterval();
+  currentTime -> set<time_t>(timeValue);
+  if (timeValue - lastActivationTime -> get<time_t>() >= intervalTime -> get<time_t>()) {
+    lastActivationTime -> set<time_t>(timeValue);
+    if (timerIndex != noTimer) {
+      objectList -> rescheduleTimer(this);
+    }
+    OBJECTFLOW_STATISTICS_SCOPE(this, statInterval);
+    callInterval();
   }
-}; 
+};
+
+// wrap-safe order of the next due times of two timer heap entries, true if the first is due before the second
+static bool dueBefore(const TimerEntry& first, const TimerEntry& second) {
+  return (int32_t)((first.lastActivation + first.interval) - (second.lastActivation + second.interval)) < 0;
+};
+
+// move a timer heap entry up to its place, returns its new position
+static uint32_t timerUp(TimerEntry* timers, uint32_t position) {
+  TimerEntry entry = timers[position];
+  while (position > 0 && dueBefore(entry, timers[(position - 1) / 2])) {
+    timers[position] = timers[(position - 1) / 2];
+    timers[position].object -> timerIndex = position;
+    position = (position - 1) / 2;
+  };
+  timers[position] = entry;
+  entry.object -> timerIndex = position;
+  return position;
+};
+
+// move a timer heap entry down to its place
+static void timerDown(TimerEntry* timers, uint32_t count, uint32_t position) {
+  TimerEntry entry = timers[position];
+  while (2 * position + 1 < count) {
+    uint32_t child = 2 * position + 1;
+    if (child + 1 < count && dueBefore(timers[child + 1], timers[child])) {
+      child++;
+    }
+    if (!dueBefore(timers[child], entry)) {
+      break;
+    }
+    timers[position] = timers[child];
+    timers[position].object -> timerIndex = position;
+    position = child;
+  };
+  timers[position] = entry;
+  entry.object -> timerIndex = position;
+};
+
+// build the timer heap from the timer resources of all Objects, returns the number of Objects in it
+uint32_t ObjectListBase::buildTimers() {
+  timerCount = 0;
+  dueCount = 0;
+  for (Object* object = firstObject; object != NULL; object = object -> nextObject) {
+    object -> timerIndex = noTimer;
+    Resource* intervalTime = object -> getResourceByID(IntervalTimeType, 0);
+    Resource* lastActivationTime = object -> getResourceByID(LastActivationTimeType, 0);
+    if (NULL == intervalTime || NULL == lastActivationTime || NULL == object -> getResourceByID(CurrentTimeType, 0)) {
+      continue;
+    }
+    if (0 == intervalTime -> get<time_t>()) { // due on every call
+      if (dueCount == dueCapacity) {
+        uint32_t capacity = (0 == dueCapacity ? 4 : 2 * dueCapacity);
+        Object** grown = new Object*[capacity];
+        for (uint32_t position = 0; position < dueCount; position++) {
+          grown[position] = dueObjects[position];
+        };
+        delete[] dueObjects;
+        dueObjects = grown;
+        dueCapacity = capacity;
+      }
+      dueObjects[dueCount++] = object;
+      object -> timerIndex = dueTimer;
+      continue;
+    }
+    if (timerCount == timerCapacity) {
+      uint32_t capacity = (0 == timerCapacity ? 8 : 2 * timerCapacity);
+      TimerEntry* grown = new TimerEntry[capacity];
+      for (uint32_t position = 0; position < timerCount; position++) {
+        grown[position] = timers[position];
+      };
+      delete[] timers;
+      timers = grown;
+      timerCapacity = capacity;
+    }
+    timers[timerCount] = (TimerEntry){ lastActivationTime -> get<time_t>(), intervalTime -> get<time_t>(), object };
+    object -> timerIndex = timerCount++;
+  };
+  for (uint32_t position = timerCount / 2; position-- > 0; ) {
+    timerDown(timers, timerCount, position);
+  };
+  timersValid = true;
+  return timerCount + dueCount;
+};
+
+// move an Object in the timer heap after its IntervalTime or LastActivationTime changed, adding or removing it
+void ObjectListBase::rescheduleTimer(Object* object) {
+  if (!timersValid) { // updateTimers builds the heap again
+    return;
+  }
+  Resource* intervalTime = object -> getResourceByID(IntervalTimeType, 0);
+  Resource* lastActivationTime = object -> getResourceByID(LastActivationTimeType, 0);
+  uint32_t position = object -> timerIndex;
+  bool timed = (intervalTime != NULL && lastActivationTime != NULL && object -> getResourceByID(CurrentTimeType, 0) != NULL);
+  if ((dueTimer == position) != (timed && 0 == intervalTime -> get<time_t>())) {
+    timersValid = false; // moves between the heap and the due Objects, updateTimers builds both again
+    return;
+  }
+  if (dueTimer == position) { // still due on every call
+    return;
+  }
+  if (!timed) {
+    if (position != noTimer) { // the last entry takes its place
+      object -> timerIndex = noTimer;
+      if (position < --timerCount) {
+        timers[position] = timers[timerCount];
+        timerDown(timers, timerCount, timerUp(timers, position));
+      }
+    }
+    return;
+  }
+  if (noTimer == position) {
+    if (timerCount == timerCapacity) {
+      timersValid = false; // buildTimers grows the heap
+      return;
+    }
+    position = timerCount++;
+  }
+  timers[position] = (TimerEntry){ lastActivationTime -> get<time_t>(), intervalTime -> get<time_t>(), object };
+  timerDown(timers, timerCount, timerUp(timers, position));
+};
+
+// update CurrentTime and LastActivationTime and call onInterval of each Object that is due at the time,
+// as updateCurrentTime does, returns the number of Objects run. Each Object runs at most once a call
+uint32_t ObjectListBase::updateTimers(time_t timeValue) {
+  if (!timersValid) {
+    buildTimers();
+  }
+  uint32_t run = 0;
+  for (uint32_t position = 0; position < dueCount; position++) {
+    Object* object = dueObjects[position];
+    object -> getResourceByID(CurrentTimeType, 0) -> set<time_t>(timeValue);
+    object -> getResourceByID(LastActivationTimeType, 0) -> set<time_t>(timeValue);
+    run++;
+    OBJECTFLOW_STATISTICS_SCOPE(object, statInterval);
+    object -> callInterval();
+  };
+  uint32_t count = run + timerCount;
+  while (run < count && timerCount > 0 && timeValue - timers[0].lastActivation >= timers[0].interval) {
+    Object* object = timers[0].object;
+    timers[0].lastActivation = timeValue; // next due an interval from now
+    timerDown(timers, timerCount, 0);
+    object -> getResourceByID(CurrentTimeType, 0) -> set<time_t>(timeValue);
+    object -> getResourceByID(LastActivationTimeType, 0) -> set<time_t>(timeValue);
+    run++;
+    OBJECTFLOW_STATISTICS_SCOPE(object, statInterval);
+    object -> callInterval();
+  };
+  return run;
+};
+
+// the time the first timed Object is due, returns false if there are no timed Objects, Objects due on every call don't count
+bool ObjectListBase::nextDeadline(time_t* deadline) {
+  if (!timersValid) {
+    buildTimers();
+  }
+  if (0 == timerCount) {
+    return false;
+  }
+  *deadline = timers[0].lastActivation + timers[0].interval;
+  return true;
+};
 
 /*
 Internal Interface extension, application logic is implemented by extending/overriding these methods
@@ -240,33 +632,151 @@ AnyValueType Object::onInputSync() {
 }; 
 
 // construct with an empty object list
-ObjectList::ObjectList() {
+ObjectListBase::ObjectListBase() {
+  firstObject = NULL;
+  lastObject = NULL;
+  index = NULL;
+  indexSize = 0;
+  objectCount = 0;
+  indexStatic = false;
+  schedule = NULL;
+  scheduleCount = 0;
+  scheduleCapacity = 0;
+  scheduleStatic = false;
+  partitions = NULL;
+  partitionCount = 0;
+  partitionCapacity = 0;
+  flowScheduled = false;
+  scheduleValid = false;
+  batchCount = 0;
+  timers = NULL;
+  timerCount = 0;
+  timerCapacity = 0;
+  dueObjects = NULL;
+  dueCount = 0;
+  dueCapacity = 0;
+  timersValid = false;
+  batchScratch = NULL;
+  batchScratchSize = 0;
+};
+
+// frees all Objects and Resources
+ObjectList::~ObjectList() {
+  freeObjects();
+};
+
+// free all Objects and Resources, leaving an empty object list
+// the nodes and link arrays are in the arena and are freed with it, a static graph is only unlinked
+void ObjectListBase::freeObjects() {
+  if (!indexStatic) {
+    delete[] index;
+  }
+  if (!scheduleStatic) {
+    delete[] schedule;
+    delete[] partitions;
+  }
+  delete[] timers;
+  delete[] dueObjects;
+  delete[] batchScratch;
+  arena.release();
+#ifdef OBJECTFLOW_IMAGE
+  releaseImage(); // after the Objects that use it
+#endif
   firstObject = NULL;
+  lastObject = NULL;
+  index = NULL;
+  indexSize = 0;
+  objectCount = 0;
+  schedule = NULL;
+  scheduleCount = 0;
+  scheduleCapacity = 0;
+  partitions = NULL;
+  partitionCount = 0;
+  partitionCapacity = 0;
+  scheduleStatic = false;
+  scheduleValid = false;
+  timers = NULL;
+  timerCount = 0;
+  timerCapacity = 0;
+  dueObjects = NULL;
+  dueCount = 0;
+  dueCapacity = 0;
+  timersValid = false;
+  batchScratch = NULL;
+  batchScratchSize = 0;
+};
+
+
+Object* ObjectListBase::newObject(uint16_t type, uint16_t instance) {
+  Object* object = getObjectByID(type, instance);
+  if (object != NULL) { // already exists, there is only one Object per type and instance
+    return object;
+  }
+  object = applicationObject(type, instance, firstObject);
+  if (NULL == object) {
+    printf("newObject out of memory\n");
+    return NULL;
+  }
+  return addObject(object);
 };
 
-Object* ObjectList::newObject(uint16_t type, uint16_t instance) {
-  // find the last object in the chain, has a null nextobject pointer
-  // FIXME check if it already exists?
+// add an Object made by the caller to the list
+Object* ObjectListBase::addObject(Object* object) {
+  if (getObjectByID(object -> typeID, object -> instanceID) != NULL) {
+    printf("addObject [%d, %d] is already in the list\n", object -> typeID, object -> instanceID);
+    return NULL;
+  }
   if (NULL == firstObject) { // make first object and add to the list (sets property of the ObjectList)
-    //this -> firstObject = new Object(type, instance, firstObject);
-    this -> firstObject = applicationObject(type, instance, firstObject);
-    return firstObject;
-  }
-  else { // already have the first object, find the end of the list 
-    Object* object = firstObject;
-    while (object -> nextObject != NULL) {
-      object = object -> nextObject;
+    this -> firstObject = object;
+  }
+  else { // already have the first object, append to the last one
+    lastObject -> nextObject = object;
+  };
+  lastObject = object;
+  object -> objectList = this;
+  scheduleValid = false;
+  linkGeneration++; // a link that was dangling may have this Object as its target
+  indexObject(object);
+  return object; 
+};
+
+// add an Object to the hash index, growing the index to keep the load factor at or below 1/2
+void ObjectListBase::indexObject(Object* object) {
+  if ( (objectCount + 1) * 2 > indexSize ) { // double the index and re-insert the existing entries
+    uint32_t oldSize = indexSize;
+    ObjectIndexEntry* oldIndex = index;
+    indexSize = (0 == oldSize ? 8 : oldSize * 2);
+    index = new ObjectIndexEntry[indexSize];
+    for (uint32_t slot = 0; slot < indexSize; slot++) {
+      index[slot].object = NULL;
     };
-    // make instance and add the new resource (sets property of the last Object)
-    //object -> nextObject = new Object(type, instance, firstObject);
-    object -> nextObject = applicationObject(type, instance, firstObject);
-    return object -> nextObject; 
-  };     
+    for (uint32_t slot = 0; slot < oldSize; slot++) {
+      if (oldIndex[slot].object != NULL) {
+        uint32_t newSlot = objectIndexSlot(oldIndex[slot].key, indexSize);
+        while (index[newSlot].object != NULL) {
+          newSlot = (newSlot + 1) & (indexSize - 1);
+        };
+        index[newSlot] = oldIndex[slot];
+      }
+    };
+    if (!indexStatic) {
+      delete[] oldIndex;
+    }
+    indexStatic = false;
+  }
+  uint32_t key = objectIndexKey(object -> typeID, object -> instanceID);
+  uint32_t slot = objectIndexSlot(key, indexSize);
+  while (index[slot].object != NULL) { // linear probe to the first empty slot
+    slot = (slot + 1) & (indexSize - 1);
+  };
+  index[slot].key = key;
+  index[slot].object = object;
+  objectCount++;
 };
 
 /* The implementation for this is in handlers.cpp due to dependency on types
 // Select an application Object based on its typeID
-Object* ObjectList::applicationObject(uint16_t type, uint16_t instance, Object* firstObject) {
+Object* ObjectListBase::applicationObject(uint16_t type, uint16_t instance, Object* firstObject) {
   switch (type) {
     default: return new Object(type, instance, firstObject);
   }
@@ -274,61 +784,480 @@ Object* ObjectList::applicationObject(uint16_t type, uint16_t instance, Object*
 */
 
 // return a pointer to the first object that matches the type and instance
-Object* ObjectList::getObjectByID(uint16_t type, uint16_t instance) {
+Object* ObjectListBase::getObjectByID(uint16_t type, uint16_t instance) {
+  if (0 == objectCount) {
+    return NULL;
+  }
+  uint32_t key = objectIndexKey(type, instance);
+  uint32_t slot = objectIndexSlot(key, indexSize);
+  while (index[slot].object != NULL) { // probe until the key or an empty slot is found
+    if (index[slot].key == key) {
+      return index[slot].object;
+    }
+    slot = (slot + 1) & (indexSize - 1);
+  };
+  return NULL; // doesn't exist
+};
+
+// build all of the objects and resources that appear in instances.h
+void ObjectListBase::buildInstances() {
+  buildInstances(instanceList, sizeof(instanceList)/sizeof(InstanceTemplate));
+};
+
+// build all of the objects and resources in a table of instance templates in one pass
+// rows of the same object are normally adjacent, so the object is only looked up when it changes
+void ObjectListBase::buildInstances(const InstanceTemplate* templates, uint32_t count) {
+  // size the arena for the table, objects get some room for the state of application subclasses
+  uint32_t objects = 0;
+  for (uint32_t row = 0; row < count; row++) {
+    if (0 == row || templates[row].objectTypeID != templates[row-1].objectTypeID || templates[row].objectInstanceID != templates[row-1].objectInstanceID) {
+      objects++;
+    }
+  };
+  arena.reserve(objects * (sizeof(Object) + 4 * sizeof(void*)) + count * sizeof(Resource));
+
+  Object* object = NULL;
+  for (uint32_t row = 0; row < count; row++) {
+    const InstanceTemplate* instance = &templates[row];
+    if (NULL == object || object -> typeID != instance -> objectTypeID || object -> instanceID != instance -> objectInstanceID) {
+      object = newObject(instance -> objectTypeID, instance -> objectInstanceID); // returns the object if it exists
+      if (NULL == object) {
+        return;
+      }
+    }
+    Resource* resource = object -> newResource(instance -> resourceTypeID, instance -> resourceInstanceID, instance -> valueType);
+    if (NULL == resource) {
+      return;
+    }
+    AnyValueType value = instance -> value;
+    if (stringType == instance -> valueType) { // the builder's literal, made into a handle
+      value.stringType = stringValue(instance -> value.stringType.interned);
+    }
+    resource -> setValue(value);
+    object -> callValueUpdate(instance -> resourceTypeID, instance -> resourceInstanceID, value); // as updateValueByID does
+  };
+  // resolve the lookup arrays now rather than on the first sync
+  for (object = firstObject; object != NULL; object = object -> nextObject) {
+    object -> indexResources();
+    object -> resolveDefaults();
+  };
+  resolveLinks();
+  buildSchedule();
+};
+
+// resolve the links of all Objects, reports dangling links and returns the number found
+uint32_t ObjectListBase::resolveLinks() {
+  uint32_t dangling = 0;
   Object* object = firstObject;
-  while (object != NULL && (object -> typeID != type || object -> instanceID != instance)) {
+  while (object != NULL) {
+    dangling += object -> resolveLinks();
     object = object -> nextObject;
   };
-  return object; // returns NULL if doesn't exist
+  return dangling;
 };
 
-// build all of the objects and resources that appear in instances.h
-void ObjectList::buildInstances() {
-  Object* object;
-  for(int instance=0; instance < sizeof(instanceList)/sizeof(InstanceTemplate);instance++){
-    object=getObjectByID(instanceList[instance].objectTypeID, instanceList[instance].objectInstanceID);
-    if (NULL == object) {
-      object = newObject(instanceList[instance].objectTypeID, instanceList[instance].objectInstanceID);
+// sort the Objects in link order with Kahn's algorithm and switch to scheduled flow. An OutputLink runs its
+// target after this Object and an InputLink runs this Object after its source, so runFlow can run every dirty 
+// Object once per pass with no recursion. A cycle is broken at its first Object in list order, which is 
+// reported, and a value that goes around the cycle is run on the next pass. The schedule is then grouped into 
+// partitions of linked Objects, which share no links and can be run by different threads. Returns the number of cycles
+uint32_t ObjectListBase::buildSchedule() {
+  const uint32_t none = 0xFFFFFFFF;
+  if (objectCount > scheduleCapacity || NULL == schedule) {
+    if (scheduleStatic) { // the static schedule and partitions both move to the heap
+      partitions = NULL;
+      partitionCapacity = 0;
+      scheduleStatic = false;
+    }
+    else {
+      delete[] schedule;
+    }
+    schedule = new Object*[objectCount];
+    scheduleCapacity = objectCount;
+  }
+  Object** listed = new Object*[objectCount + 1]; // Objects by list position
+  uint32_t* waiting = new uint32_t[3 * objectCount + 1]; // unscheduled links into each Object
+  uint32_t* pullFirst = &waiting[objectCount]; // first Object with an InputLink from each Object
+  uint32_t* pullNext = &waiting[2 * objectCount]; // next Object with an InputLink from the same Object
+  uint32_t position = 0;
+  for (Object* object = firstObject; object != NULL; object = object -> nextObject) {
+    if (!linksCurrent(object)) {
+      object -> resolveLinks();
+    }
+    object -> scheduleIndex = position; // list position until the schedule is done
+    listed[position] = object;
+    waiting[position] = 0;
+    pullFirst[position] = none;
+    position++;
+  };
+  for (position = objectCount; position-- > 0; ) { // backwards so each pull list is in list order
+    Object* object = listed[position];
+    for (uint16_t output = 0; output < object -> outputCount; output++) {
+      waiting[object -> outputObjects[output] -> scheduleIndex]++;
+    };
+    if (object -> inputObject != NULL) {
+      waiting[position]++;
+      pullNext[position] = pullFirst[object -> inputObject -> scheduleIndex];
+      pullFirst[object -> inputObject -> scheduleIndex] = position;
+    }
+  };
+  uint32_t head = 0;
+  uint32_t tail = 0;
+  for (position = 0; position < objectCount; position++) {
+    if (0 == waiting[position]) {
+      schedule[tail++] = listed[position];
     }
-    object -> newResource(instanceList[instance].resourceTypeID, instanceList[instance].resourceInstanceID, instanceList[instance].valueType);
-    object -> updateValueByID(instanceList[instance].resourceTypeID, instanceList[instance].resourceInstanceID, instanceList[instance].value);
   };
+  uint32_t cycles = 0;
+  position = 0;
+  while (true) {
+    while (head < tail) { // schedule the Objects whose links are all from scheduled Objects
+      Object* object = schedule[head++];
+      for (uint16_t output = 0; output < object -> outputCount; output++) {
+        uint32_t target = object -> outputObjects[output] -> scheduleIndex;
+        if (waiting[target] > 0 && 0 == --waiting[target]) {
+          schedule[tail++] = listed[target];
+        }
+      };
+      for (uint32_t target = pullFirst[object -> scheduleIndex]; target != none; target = pullNext[target]) {
+        if (waiting[target] > 0 && 0 == --waiting[target]) {
+          schedule[tail++] = listed[target];
+        }
+      };
+    };
+    while (position < objectCount && 0 == waiting[position]) {
+      position++;
+    };
+    if (position == objectCount) {
+      break;
+    }
+    printf("flow cycle at [%d, %d]\n", listed[position] -> typeID, listed[position] -> instanceID); // every Object left waits on a cycle
+    cycles++;
+    waiting[position] = 0;
+    schedule[tail++] = listed[position];
+  };
+  scheduleCount = tail;
+
+  // the partitions are the weakly connected components of the link graph, found by union-find over list 
+  // positions and numbered in list order, the arrays of the sort are reused
+  uint32_t* parent = waiting;
+  uint32_t* partitionOf = pullFirst;
+  uint32_t* partitionNext = pullNext; // next schedule position to fill in each partition
+  for (position = 0; position < objectCount; position++) {
+    parent[position] = position;
+  };
+  for (position = 0; position < objectCount; position++) {
+    Object* object = listed[position];
+    for (uint16_t link = 0; link <= object -> outputCount; link++) {
+      Object* linked = (link < object -> outputCount ? object -> outputObjects[link] : object -> inputObject);
+      if (NULL == linked) {
+        continue;
+      }
+      uint32_t root = position;
+      uint32_t linkedRoot = linked -> scheduleIndex;
+      while (parent[root] != root) {
+        root = parent[root] = parent[parent[root]];
+      };
+      while (parent[linkedRoot] != linkedRoot) {
+        linkedRoot = parent[linkedRoot] = parent[parent[linkedRoot]];
+      };
+      if (root < linkedRoot) { // the root is the first Object in list order
+        parent[linkedRoot] = root;
+      }
+      else {
+        parent[root] = linkedRoot;
+      }
+    };
+  };
+  uint32_t components = 0;
+  for (position = 0; position < objectCount; position++) { // a root is before the rest of its partition
+    uint32_t root = position;
+    while (parent[root] != root) {
+      root = parent[root];
+    };
+    partitionOf[position] = (root == position ? components++ : partitionOf[root]);
+  };
+  for (uint32_t partition = 0; partition < components; partition++) {
+    partitionNext[partition] = 0;
+  };
+  for (position = 0; position < scheduleCount; position++) { // count the Objects of each partition
+    partitionNext[partitionOf[schedule[position] -> scheduleIndex]]++;
+  };
+  uint32_t first = 0;
+  for (uint32_t partition = 0; partition < components; partition++) {
+    uint32_t count = partitionNext[partition];
+    partitionNext[partition] = first;
+    first += count;
+  };
+  for (position = 0; position < scheduleCount; position++) { // stable, so each partition keeps the link order
+    Object* object = schedule[position];
+    object -> partition = partitionOf[object -> scheduleIndex];
+    listed[partitionNext[object -> partition]++] = object;
+  };
+  if (components > partitionCapacity || NULL == partitions) {
+    if (scheduleStatic) { // the static schedule and partitions both move to the heap
+      schedule = new Object*[objectCount];
+      scheduleCapacity = objectCount;
+      scheduleStatic = false;
+    }
+    else {
+      delete[] partitions;
+    }
+    partitions = new FlowPartition[components];
+    partitionCapacity = components;
+  }
+  partitionCount = components;
+  first = 0;
+  for (uint32_t partition = 0; partition < partitionCount; partition++) {
+    FlowPartition* range = &partitions[partition];
+    range -> first = first;
+    range -> count = partitionNext[partition] - first; // the fill left the end of each partition
+    range -> dirtyFrom = partitionNext[partition];
+    range -> runPosition = first;
+    range -> running = false;
+    first = partitionNext[partition];
+  };
+  for (position = 0; position < scheduleCount; position++) {
+    Object* object = listed[position];
+    FlowPartition* range = &partitions[object -> partition];
+    schedule[position] = object;
+    object -> scheduleIndex = position;
+    if (object -> dirty && position < range -> dirtyFrom) {
+      range -> dirtyFrom = position;
+    }
+  };
+  delete[] listed;
+  delete[] waiting;
+  scheduleValid = true;
+  return cycles;
+};
+
+// mark an Object to be run by runFlow, an Object ahead of the current position in a run is run in the same pass
+void ObjectListBase::markDirty(Object* object) {
+  if (object -> dirty) {
+    return;
+  }
+  object -> dirty = true;
+  if (!scheduleValid) { // found by buildSchedule
+    return;
+  }
+  FlowPartition* partition = &partitions[object -> partition];
+  if (partition -> running && object -> scheduleIndex > partition -> runPosition) { // run later in this pass
+    return;
+  }
+  if (object -> scheduleIndex < partition -> dirtyFrom) {
+    partition -> dirtyFrom = object -> scheduleIndex;
+  }
+};
+
+// run each dirty Object once in schedule order, Objects updated by it come later in the schedule and are run 
+// in the same pass, except around a cycle. Returns the number of Objects run
+uint32_t ObjectListBase::runFlow() {
+  if (!scheduleValid) {
+    buildSchedule();
+    if (!scheduleValid) {
+      return 0;
+    }
+  }
+  uint32_t run = 0;
+  for (uint32_t partition = 0; partition < partitionCount; partition++) {
+    run += runPartition(partition);
+  };
+  return run;
+};
+
+// run the dirty Objects of one partition, it only touches the Objects and run state of that partition so 
+// partitions can be run by different threads. Returns the number of Objects run
+uint32_t ObjectListBase::runPartition(uint32_t partition) {
+  FlowPartition* range = &partitions[partition];
+  uint32_t end = range -> first + range -> count;
+  uint32_t run = 0;
+  range -> running = true;
+  range -> runPosition = range -> dirtyFrom;
+  range -> dirtyFrom = end;
+  for ( ; range -> runPosition < end; range -> runPosition++) {
+    Object* object = schedule[range -> runPosition];
+    if (object -> dirty) {
+      object -> dirty = false;
+      OBJECTFLOW_STATISTICS_SCOPE(object, statDefaultValueUpdate);
+      object -> callDefaultValueUpdate();
+      run++;
+    }
+  };
+  range -> running = false;
+  return run;
+};
+
+// slot of a pointer in an open addressing table, size is a power of 2
+static inline uint32_t pointerSlot(void* pointer, uint32_t size) {
+  uint32_t hash = (uint32_t)((uintptr_t)pointer >> 3) * 2654435761u;
+  return (hash ^ (hash >> 16)) & (size - 1);
+};
+
+// apply a batch of resource updates and call onValuesUpdate once for each Object updated, with its changed 
+// resources in batch order. Objects are notified in the order they first appear, after all values are written. 
+// A resource updated twice is listed once with the last value, and unknown Objects and resources are reported 
+// and skipped. Returns the number of updates applied
+uint32_t ObjectListBase::updateValues(const ValueUpdate* updates, uint32_t count) {
+  const uint32_t none = 0xFFFFFFFF;
+  uint32_t runs = 0; // runs of updates of the same Object, at least the number of Objects
+  for (uint32_t position = 0; position < count; position++) {
+    if (0 == position || updates[position].objectTypeID != updates[position-1].objectTypeID || 
+      updates[position].objectInstanceID != updates[position-1].objectInstanceID) {
+      runs++;
+    }
+  };
+  uint32_t tableSize = 8;
+  while (tableSize < runs * 2) {
+    tableSize *= 2;
+  };
+  // the arrays of the batch in one scratch buffer, pointers first, reused by the next batch if it is big enough.
+  // The batch takes the buffer while it runs, so a batch from onValuesUpdate allocates its own
+  size_t scratchSize = (2 * count + runs + tableSize) * sizeof(void*) + (count + runs + tableSize) * sizeof(uint32_t);
+  char* scratch = batchScratch;
+  size_t scratchCapacity = batchScratchSize;
+  batchScratch = NULL;
+  batchScratchSize = 0;
+  if (scratchSize > scratchCapacity) {
+    delete[] scratch;
+    scratchCapacity = (scratchSize > 2 * scratchCapacity ? scratchSize : 2 * scratchCapacity);
+    scratch = new char[scratchCapacity];
+  }
+  Resource** resources = (Resource**)scratch;
+  Object** objects = (Object**)&resources[2 * count];
+  uint32_t* numbers = (uint32_t*)&objects[runs + tableSize];
+  Resource** updated = resources; // Resource of each update, NULL if it is skipped or repeated
+  Resource** changed = &resources[count]; // changed Resources grouped by Object
+  Object** touched = objects; // updated Objects in order of appearance
+  Object** seenObjects = &objects[runs]; // hash table of the updated Objects to their touched position
+  uint32_t* groupOf = numbers; // touched position of the Object of each update
+  uint32_t* groupFirst = &numbers[count]; // counts, then the first changed position of each touched Object
+  uint32_t* seenGroups = &numbers[count + runs];
+  for (uint32_t slot = 0; slot < tableSize; slot++) {
+    seenObjects[slot] = NULL;
+  };
+
+  uint32_t batch = ++batchCount; // a Resource is listed once, when it doesn't have this mark yet
+  if (0 == batch) { // wrapped, 0 is the mark of a Resource never listed
+    batch = ++batchCount;
+  }
+  uint32_t applied = 0;
+  uint32_t groups = 0;
+  uint32_t group = none;
+  Object* object = NULL;
+  for (uint32_t position = 0; position < count; position++) {
+    const ValueUpdate* update = &updates[position];
+    updated[position] = NULL;
+    if (NULL == object || object -> typeID != update -> objectTypeID || object -> instanceID != update -> objectInstanceID) {
+      object = getObjectByID(update -> objectTypeID, update -> objectInstanceID); // runs of the same Object are looked up once
+      if (NULL == object) {
+        printf("updateValues couldn't find [%d, %d]\n", update -> objectTypeID, update -> objectInstanceID);
+        continue;
+      }
+      uint32_t slot = pointerSlot(object, tableSize);
+      while (seenObjects[slot] != NULL && seenObjects[slot] != object) {
+        slot = (slot + 1) & (tableSize - 1);
+      };
+      if (NULL == seenObjects[slot]) {
+        seenObjects[slot] = object;
+        seenGroups[slot] = groups;
+        touched[groups] = object;
+        groupFirst[groups] = 0;
+        groups++;
+      }
+      group = seenGroups[slot];
+    }
+    Resource* resource = object -> getResourceByID(update -> resourceTypeID, update -> resourceInstanceID);
+    if (NULL == resource) {
+      printf("updateValues couldn't find [%d, %d] [%d, %d]\n", update -> objectTypeID, update -> objectInstanceID, 
+        update -> resourceTypeID, update -> resourceInstanceID);
+      continue;
+    }
+    resource -> setValue(update -> value);
+    applied++;
+    if (InputLinkType == update -> resourceTypeID || OutputLinkType == update -> resourceTypeID) {
+      object -> linksResolved = false; // as updateValueByID does
+      scheduleValid = false;
+    }
+    if (IntervalTimeType == update -> resourceTypeID || LastActivationTimeType == update -> resourceTypeID) {
+      rescheduleTimer(object);
+    }
+    if (resource -> batch != batch) { // listed the first time it changes
+      resource -> batch = batch;
+      updated[position] = resource;
+      groupOf[position] = group;
+      groupFirst[group]++;
+    }
+  };
+
+  uint32_t first = 0;
+  for (group = 0; group < groups; group++) {
+    uint32_t resourceCount = groupFirst[group];
+    groupFirst[group] = first;
+    first += resourceCount;
+  };
+  for (uint32_t position = 0; position < count; position++) { // the fill moves each first up to the next group
+    if (updated[position] != NULL) {
+      changed[groupFirst[groupOf[position]]++] = updated[position];
+    }
+  };
+  first = 0;
+  for (group = 0; group < groups; group++) {
+    if (groupFirst[group] > first) { // none if all of its updates were skipped
+      touched[group] -> callValuesUpdate(&changed[first], groupFirst[group] - first);
+    }
+    first = groupFirst[group];
+  };
+  delete[] batchScratch; // left by a nested batch
+  batchScratch = scratch;
+  batchScratchSize = scratchCapacity;
+  return applied;
+};
+
+// total of the default value updates suppressed by the Objects because the value didn't change
+uint32_t ObjectListBase::suppressedUpdates() {
+  uint32_t suppressed = 0;
+  for (Object* object = firstObject; object != NULL; object = object -> nextObject) {
+    suppressed += object -> suppressedCount;
+  };
+  return suppressed;
 };
 
-void ObjectList::displayObjects() {
+void ObjectListBase::displayObjects() {
   Object* object = firstObject;
   while ( object != NULL) {
     printf ( "[%d, %d]\n", object -> typeID, object -> instanceID);
     Resource* resource = object -> firstResource;
     while ( resource != NULL) {
       printf ( "  [%d, %d] : ", resource -> typeID, resource -> instanceID);
+      AnyValueType value = resource -> getValue();
       switch(resource -> valueType) {
         case booleanType: {
-          printf ( "%s\n", resource -> value.booleanType ? "true": "false");
+          printf ( "%s\n", value.booleanType ? "true": "false");
           break;
         }
         case integerType: {
-          printf ( "%d\n", resource -> value.integerType);
+          printf ( "%d\n", value.integerType);
           break;
         }
         case floatType: {
-          printf ( "%f\n", resource -> value.floatType);
+          printf ( "%f\n", value.floatType);
           break;
         }
         case stringType: {
-          printf ( "%s\n", resource -> value.stringType);
+          printf ( "%s\n", value.stringType.chars());
           break;
         }
         case linkType: {
           printf ("[");
-          printf ( "%d", resource -> value.linkType.typeID);
+          printf ( "%d", value.linkType.typeID);
           printf (",");
-          printf ( "%d", resource -> value.linkType.instanceID);
+          printf ( "%d", value.linkType.instanceID);
           printf ("]\n");
           break;
         }
         case timeType: {
-          printf ( "%d\n", resource -> value.timeType);
+          printf ( "%d\n", value.timeType);
           break;
         }
         default:
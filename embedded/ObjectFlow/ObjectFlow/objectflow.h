@@ -2,14 +2,27 @@
 
 #include <stdint.h> 
 #include <stdio.h> 
+#include "arena.h"
+#include "keysearch.h"
+#include "valuemap.h"
+#include "stringvalue.h"
+#include "objectstats.h"
 
 #define time_t uint32_t
 #define true 1
 #define false 0
 
+// handlers are virtual, unless the builder's static dispatch calls them, see Object::callInterval
+#ifdef OBJECTFLOW_STATIC_DISPATCH
+#define OBJECTFLOW_HANDLER
+#else
+#define OBJECTFLOW_HANDLER virtual
+#endif
+
 /* 
 Well-known reusable Resource Types, should be in a header made from the SDF translator 
 */
+// benchmark/compiled-chain.py reads the IDs from these defines, keep them one per line as #define <Name>Type <ID>
 // Free resource range 26231-32768
 // Free object range 42769-65535 (?)
 // link types for pull and push data transfer
@@ -23,10 +36,17 @@ Well-known reusable Resource Types, should be in a header made from the SDF tran
 #define CurrentTimeType 27005
 #define IntervalTimeType 27006
 #define LastActivationTimeType 27007
+// Change of a float default value that is propagated, a negative deadband propagates every update
+#define DeadbandType 27017
+// Handler call counts and times of an Object, read only and present in OBJECTFLOW_STATS builds, see objectstats.h
+#define StatisticsType 27018
 
 namespace ObjectFlow
 
 {
+  class Object;
+  class ObjectListBase;
+
   /* common types */
 
   struct InstanceLink {
@@ -40,11 +60,92 @@ namespace ObjectFlow
     bool booleanType;
     int integerType;
     double floatType;
-    char* stringType;
+    StringValue stringType;
     InstanceLink linkType;
     time_t timeType;
   };
 
+#ifdef OBJECTFLOW_SEQLOCK
+  /*
+  Seqlock for values that other threads read while the flow runs (OBJECTFLOW_SEQLOCK). A writer makes the 
+  sequence odd, stores the value and makes the sequence even again. A reader copies the value between two 
+  loads of the sequence and tries again if it was odd or changed, so readers never block the writer and never 
+  see half of an update. Writers take the odd sequence with a compare and swap, so they may be on any thread.
+  */
+  typedef uint64_t __attribute__((may_alias)) AnyValueBits;
+  static_assert(sizeof(AnyValueType) == sizeof(AnyValueBits), "seqlock copies values as one 64 bit word");
+
+  inline void seqlockWrite(uint32_t* sequence, AnyValueType* slot, AnyValueType value) {
+    uint32_t current = __atomic_load_n(sequence, __ATOMIC_RELAXED);
+    while ((current & 1) || !__atomic_compare_exchange_n(sequence, &current, current + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+      current = __atomic_load_n(sequence, __ATOMIC_RELAXED); // another writer has it
+    };
+    __atomic_thread_fence(__ATOMIC_RELEASE); // the odd sequence is seen before the value changes
+    __atomic_store_n((AnyValueBits*)slot, *(AnyValueBits*)&value, __ATOMIC_RELAXED);
+    __atomic_store_n(sequence, current + 2, __ATOMIC_RELEASE);
+  };
+
+  inline AnyValueType seqlockRead(uint32_t* sequence, AnyValueType* slot) {
+    AnyValueType value;
+    while (true) {
+      uint32_t before = __atomic_load_n(sequence, __ATOMIC_ACQUIRE);
+      *(AnyValueBits*)&value = __atomic_load_n((AnyValueBits*)slot, __ATOMIC_RELAXED);
+      __atomic_thread_fence(__ATOMIC_ACQUIRE); // the value is read before the sequence is checked
+      if (0 == (before & 1) && __atomic_load_n(sequence, __ATOMIC_RELAXED) == before) {
+        return value;
+      }
+    };
+  };
+#endif
+
+  /*
+  Typed values. ValueTraits binds a C++ type to its ValueType and union member, so Resource::get<T> and set<T>
+  compile to a load or store of the member. ResourceTraits binds a resource type ID to the C++ type of its
+  value, for Object::get<type> and set<type>; the runtime's own types are here and the builder's resourceHeader
+  adds the model's types with one value type. A type without traits doesn't compile. OBJECTFLOW_CHECK_TYPES
+  reports a typed access to a resource of another value type, for debug builds.
+  */
+  template <typename T> struct ValueTraits;
+  template <> struct ValueTraits<bool> {
+    static const ValueType valueType = booleanType;
+    static bool read(AnyValueType value) { return value.booleanType; };
+    static void write(AnyValueType* value, bool typed) { value -> booleanType = typed; };
+  };
+  template <> struct ValueTraits<int> {
+    static const ValueType valueType = integerType;
+    static int read(AnyValueType value) { return value.integerType; };
+    static void write(AnyValueType* value, int typed) { value -> integerType = typed; };
+  };
+  template <> struct ValueTraits<double> {
+    static const ValueType valueType = floatType;
+    static double read(AnyValueType value) { return value.floatType; };
+    static void write(AnyValueType* value, double typed) { value -> floatType = typed; };
+  };
+  template <> struct ValueTraits<StringValue> {
+    static const ValueType valueType = stringType;
+    static StringValue read(AnyValueType value) { return value.stringType; };
+    static void write(AnyValueType* value, StringValue typed) { value -> stringType = typed; };
+  };
+  template <> struct ValueTraits<InstanceLink> {
+    static const ValueType valueType = linkType;
+    static InstanceLink read(AnyValueType value) { return value.linkType; };
+    static void write(AnyValueType* value, InstanceLink typed) { value -> linkType = typed; };
+  };
+  template <> struct ValueTraits<time_t> {
+    static const ValueType valueType = timeType;
+    static time_t read(AnyValueType value) { return value.timeType; };
+    static void write(AnyValueType* value, time_t typed) { value -> timeType = typed; };
+  };
+
+  template <uint16_t resourceType> struct ResourceTraits;
+  template <> struct ResourceTraits<InputLinkType> { typedef InstanceLink type; };
+  template <> struct ResourceTraits<OutputLinkType> { typedef InstanceLink type; };
+  template <> struct ResourceTraits<CurrentTimeType> { typedef time_t type; };
+  template <> struct ResourceTraits<IntervalTimeType> { typedef time_t type; };
+  template <> struct ResourceTraits<LastActivationTimeType> { typedef time_t type; };
+  template <> struct ResourceTraits<DeadbandType> { typedef double type; };
+  template <> struct ResourceTraits<StatisticsType> { typedef double type; };
+
   struct InstanceTemplate {
     uint16_t objectTypeID;
     uint16_t objectInstanceID;
@@ -54,6 +155,15 @@ namespace ObjectFlow
     AnyValueType value;
   };
 
+  // One resource update of a batch for ObjectList::updateValues
+  struct ValueUpdate {
+    uint16_t objectTypeID;
+    uint16_t objectInstanceID;
+    uint16_t resourceTypeID;
+    uint16_t resourceInstanceID;
+    AnyValueType value;
+  };
+
   /* base classes */
 
   /* Resource: expose values and chain together into a linked list for each object*/
@@ -61,11 +171,77 @@ namespace ObjectFlow
     public:
       uint16_t typeID;
       uint16_t instanceID;    
+      uint32_t batch = 0; // last ObjectList::updateValues batch that listed this resource, fits in padding
       Resource* nextResource;
       ValueType valueType;
+#ifdef OBJECTFLOW_SEQLOCK
+      uint32_t sequence = 0; // seqlock of the value, fits in the padding before it
+#endif
       AnyValueType value;
   // Construct with type and instance + value type
       Resource(uint16_t type, uint16_t instance, ValueType vtype);
+  // Construct with a value and the next resource, for statically initialized graphs
+      constexpr Resource(uint16_t type, uint16_t instance, ValueType vtype, AnyValueType initialValue, Resource* next) :
+        typeID(type), instanceID(instance), nextResource(next), valueType(vtype), value(initialValue) {};
+  // Read and write the value, through the seqlock if values are shared with other threads
+#ifdef OBJECTFLOW_SEQLOCK
+      AnyValueType getValue() { return seqlockRead(&sequence, &value); };
+      void setValue(AnyValueType newValue) { seqlockWrite(&sequence, &value, newValue); };
+#else
+      AnyValueType getValue() { return value; };
+      void setValue(AnyValueType newValue) { value = newValue; };
+#endif
+  // Read and write the value as a C++ type, see ValueTraits
+      template <typename T> T get() {
+        checkType(ValueTraits<T>::valueType);
+        return ValueTraits<T>::read(getValue());
+      };
+      template <typename T> void set(T typed) {
+        checkType(ValueTraits<T>::valueType);
+        AnyValueType newValue;
+        ValueTraits<T>::write(&newValue, typed);
+        setValue(newValue);
+      };
+#ifdef OBJECTFLOW_CHECK_TYPES
+      void checkType(ValueType typed) {
+        if (typed != valueType) {
+          printf("resource [%d, %d] of value type %d used as value type %d\n", typeID, instanceID, valueType, typed);
+        }
+      };
+#else
+      void checkType(ValueType typed) {};
+#endif
+  };
+
+  /* 
+  Pre-resolved state of an Object in a statically initialized graph (OBJECTFLOW_STATIC_GRAPH). The builder 
+  emits one for each Object in static-instances.h, with the chains, default resources and links already 
+  resolved. Application Object classes provide a constexpr constructor that passes it to the Object constructor.
+  */
+  // timerIndex of an Object that isn't in the timer heap
+  const uint32_t noTimer = 0xFFFFFFFF;
+  // timerIndex of an Object with IntervalTime 0, in the ObjectList list of Objects due on every updateTimers call
+  const uint32_t dueTimer = 0xFFFFFFFE;
+
+  struct ObjectInit {
+    uint16_t typeID;
+    uint16_t instanceID;
+    Object* nextObject;
+    Object* firstObject;
+    Resource* firstResource;
+    Resource* lastResource;
+    ObjectListBase* objectList;
+    Resource* defaultSource;
+    Resource* defaultDestination;
+    Object* inputObject;
+    Object** outputObjects;
+    uint16_t outputCount;
+    uint32_t* resourceKeys;
+    Resource** resourceTable;
+    uint16_t resourceCount;
+    uint32_t scheduleIndex;
+    uint32_t partition;
+    Resource* deadband;
   };
 
 
@@ -78,10 +254,67 @@ namespace ObjectFlow
       Object* nextObject; // next Object in the chain
       Object* firstObject; // first Object in the ObjectList
       Resource* firstResource; // first resource in the list for this object
+      Resource* lastResource; // last resource in the list, newResource appends here
+      ObjectListBase* objectList; // ObjectList this Object belongs to, set by ObjectList::newObject
+
+      // Default value resources used for sync, resolved on first use and invalidated by newResource
+      Resource* defaultSource; // first of OutputValue, CurrentValue, InputValue
+      Resource* defaultDestination; // first of InputValue, CurrentValue, OutputValue
+      Resource* deadband; // Deadband resource, NULL if there is none
+      bool defaultsResolved;
+
+      // default value updates that were suppressed because the value didn't change
+      uint32_t suppressedCount;
+
+      // Link targets resolved from the InputLink and OutputLink resources, invalidated by newResource,
+      // by updateValueByID on a link resource and by newObject of another Object in the list
+      Object* inputObject; // source Object of InputLink 0, NULL if there is none or it is dangling
+      Object** outputObjects; // target Objects of the OutputLink resources in resource order
+      uint16_t outputCount;
+      uint16_t outputCapacity; // size of the outputObjects array
+      bool linksResolved;
+      uint32_t linkGeneration = 0; // ObjectList::linkGeneration when the links were resolved
+
+      // Packed (type, instance) keys of the resources in list order, searched by getResourceByID with the
+      // keysearch kernel, and the matching Resources. Built on first use and invalidated by newResource.
+      // Define OBJECTFLOW_NO_RESOURCE_INDEX to search the resource list instead on the smallest targets
+      uint32_t* resourceKeys;
+      Resource** resourceTable;
+      uint16_t resourceCount;
+      uint16_t resourceCapacity; // size of the resourceKeys and resourceTable arrays
+      bool resourcesIndexed;
+
+      // Position in the ObjectList flow schedule and its partition, and set when a default value update is waiting for runFlow
+      uint32_t scheduleIndex;
+      uint32_t partition;
+      bool dirty;
+
+      // Position in the ObjectList timer heap, noTimer if the Object isn't timed, dueTimer if it is always due
+      uint32_t timerIndex = noTimer;
+
+#ifdef OBJECTFLOW_COMPILED_FLOW
+      // set by syncToOutputLink while a compiled flow runs, the flow copies the values along the links if it is
+      bool synced = false;
+#endif
+
+#ifdef OBJECTFLOW_STATS
+      // calls and times of the handlers and syncs, read as the StatisticsType resource
+      ObjectStatistics statistics = {};
+#endif
 
       // Construct with type and instance and empty list
       Object(uint16_t type, uint16_t instance, Object* listFirstObject);   
 
+      // Construct with pre-resolved state, for statically initialized graphs
+      constexpr Object(const ObjectInit& init) : 
+        typeID(init.typeID), instanceID(init.instanceID), nextObject(init.nextObject), firstObject(init.firstObject), 
+        firstResource(init.firstResource), lastResource(init.lastResource), objectList(init.objectList), 
+        defaultSource(init.defaultSource), defaultDestination(init.defaultDestination), deadband(init.deadband), defaultsResolved(true), suppressedCount(0),
+        inputObject(init.inputObject), outputObjects(init.outputObjects), outputCount(init.outputCount), 
+        outputCapacity(init.outputCount), linksResolved(true), resourceKeys(init.resourceKeys), resourceTable(init.resourceTable),
+        resourceCount(init.resourceCount), resourceCapacity(init.resourceCount), resourcesIndexed(init.resourceKeys != NULL),
+        scheduleIndex(init.scheduleIndex), partition(init.partition), dirty(false) {};
+
       // Interface to create a new resource in this object
       Resource* newResource(uint16_t type, uint16_t instance, ValueType vtype);
 
@@ -90,12 +323,19 @@ namespace ObjectFlow
       // return a pointer to the first resource in this object that matches the type and instance
       Resource* getResourceByID(uint16_t type, uint16_t instance);
 
+      // build the resourceKeys and resourceTable arrays from the resource list
+      void indexResources();
+
       // return a pointer to the first object in the Object list that matches the type and instance
       Object* getObjectByID(uint16_t type, uint16_t instance);
 
       // Value Interfaces
       
       // Interface to Read Value
+      // with OBJECTFLOW_SEQLOCK other threads may read values while the flow runs, once the Objects and 
+      // Resources are built, for example by buildInstances. Objects, Resources and links must not change then.
+      // getResourceByID doesn't build the resource index then, buildInstances and loadImage do, call 
+      // indexResources of Objects made with newObject and newResource before other threads read
 
       AnyValueType readValueByID(uint16_t type, uint16_t instance); 
       
@@ -103,8 +343,47 @@ namespace ObjectFlow
 
       void updateValueByID(uint16_t type, uint16_t instance, AnyValueType value);
 
+      // Typed interfaces, as readValueByID and updateValueByID with the value as a C++ type, see ValueTraits
+      template <typename T> T get(uint16_t type, uint16_t instance) {
+        Resource* resource = getResourceByID(type, instance);
+        if (NULL == resource) {
+          return ValueTraits<T>::read(readValueByID(type, instance)); // a virtual resource, or the NULL report
+        }
+        return resource -> get<T>();
+      };
+      template <typename T> void set(uint16_t type, uint16_t instance, T typed) {
+        AnyValueType value;
+        ValueTraits<T>::write(&value, typed);
+#ifdef OBJECTFLOW_CHECK_TYPES
+        Resource* resource = getResourceByID(type, instance);
+        if (resource != NULL) {
+          resource -> checkType(ValueTraits<T>::valueType);
+        }
+#endif
+        updateValueByID(type, instance, value);
+      };
+      // the C++ type bound to the resource type, see ResourceTraits
+      template <uint16_t type> typename ResourceTraits<type>::type get(uint16_t instance) {
+        return get<typename ResourceTraits<type>::type>(type, instance);
+      };
+      template <uint16_t type> void set(uint16_t instance, typename ResourceTraits<type>::type typed) {
+        set<typename ResourceTraits<type>::type>(type, instance, typed);
+      };
+
+#ifdef OBJECTFLOW_STATS
+      // value of a field of the handler statistics, see statisticsInstance
+      AnyValueType readStatistics(uint16_t instance);
+
+      // clear the handler statistics
+      void resetStatistics();
+#endif
+
       // Application logic overrides this method
-      virtual void onValueUpdate(uint16_t type, uint16_t instance, AnyValueType value); 
+      OBJECTFLOW_HANDLER void onValueUpdate(uint16_t type, uint16_t instance, AnyValueType value); 
+
+      // Application logic may override this to handle the resources of a batch from ObjectList::updateValues 
+      // in one call, the default calls onValueUpdate for each resource
+      OBJECTFLOW_HANDLER void onValuesUpdate(Resource** resources, uint16_t count); 
 
       /* 
 
@@ -152,8 +431,19 @@ namespace ObjectFlow
       AnyValueType readDefaultValue(); 
 
       // extended interface for default value sync
+      // an update that doesn't change the value is suppressed and isn't propagated, see valueChanged
+      // in a scheduled flow the handler is deferred to ObjectList::runFlow instead of called here
       void updateDefaultValue(AnyValueType value); 
 
+      // compare a new value with the value of a resource by its value type, float values with the deadband
+      bool valueChanged(Resource* resource, AnyValueType value); 
+
+      // select the default source and destination resources by priority ranking, and the deadband
+      void resolveDefaults(); 
+
+      // resolve the link resources to Object pointers, returns the number of dangling links
+      uint16_t resolveLinks(); 
+
       /* 
       Timer extension
       */
@@ -165,24 +455,160 @@ namespace ObjectFlow
       */
 
       // Handler for Timer Interval
-      virtual void onInterval(); 
+      OBJECTFLOW_HANDLER void onInterval(); 
 
       // Handler for DefaultValue update, called from either input or output sync
-      virtual void onDefaultValueUpdate(); 
+      OBJECTFLOW_HANDLER void onDefaultValueUpdate(); 
 
       // Handler to return value in response to input sync from another object
-      virtual AnyValueType onInputSync(); 
+      OBJECTFLOW_HANDLER AnyValueType onInputSync(); 
+
+      // The runtime calls the handlers through these. They are virtual calls, or with OBJECTFLOW_STATIC_DISPATCH
+      // a switch on typeID with a direct call to the handler of the application class, made by the builder 
+      // with applicationObject, so the handlers may be inlined and Objects have no vtable
+#ifdef OBJECTFLOW_STATIC_DISPATCH
+      void callValueUpdate(uint16_t type, uint16_t instance, AnyValueType value);
+      void callValuesUpdate(Resource** resources, uint16_t count);
+      void callInterval();
+      void callDefaultValueUpdate();
+      AnyValueType callInputSync();
+#else
+      void callValueUpdate(uint16_t type, uint16_t instance, AnyValueType value) { onValueUpdate(type, instance, value); };
+      void callValuesUpdate(Resource** resources, uint16_t count) { onValuesUpdate(resources, count); };
+      void callInterval() { onInterval(); };
+      void callDefaultValueUpdate() { onDefaultValueUpdate(); };
+      AnyValueType callInputSync() { return onInputSync(); };
+#endif
   };
 
-  class ObjectList {
+  // Entry of the ObjectList timer heap, an Object is due when (time - lastActivation >= interval), as in updateCurrentTime
+  struct TimerEntry {
+    time_t lastActivation;
+    time_t interval;
+    Object* object;
+  };
+
+  // Slot in the ObjectList hash index, key is (typeID << 16 | instanceID), empty slot has a NULL object
+  struct ObjectIndexEntry {
+    uint32_t key;
+    Object* object;
+  };
+
+  // index key and first probe slot for an Object type and instance, size is a power of 2
+  inline uint32_t objectIndexKey(uint16_t type, uint16_t instance) {
+    return ((uint32_t)type << 16) | instance;
+  };
+
+  inline uint32_t objectIndexSlot(uint32_t key, uint32_t size) {
+    uint32_t hash = key * 2654435761u; // multiplicative hash, then fold the high bits down
+    return (hash ^ (hash >> 16)) & (size - 1);
+  };
+
+  // Run state of a weakly connected part of the flow, a contiguous range of the schedule with no links to other partitions
+  struct FlowPartition {
+    uint32_t first; // schedule position of the first Object
+    uint32_t count;
+    uint32_t dirtyFrom; // schedule position of the first dirty Object, first + count if there is none
+    uint32_t runPosition; // schedule position runPartition has reached
+    bool running;
+  };
+
+  /*
+  The flow of an ObjectList without its destructor. The Objects, the runtime and the extensions work through an
+  ObjectListBase, so static storage of this type can hold a flow and needs no exit handler, as the static graph in
+  static-instances.h does. Its arena, index, schedule and timers are freed by freeObjects. ObjectList frees them
+  when it's destroyed and is the type to use for a flow that is built at run time.
+  */
+  class ObjectListBase {
     public:
       // construct with an empty object list
-      ObjectList();
+      ObjectListBase();
+      // construct over statically initialized Objects and index, see static-instances.h
+      constexpr ObjectListBase(Object* first, Object* last, ObjectIndexEntry* staticIndex, uint32_t staticIndexSize, uint32_t count, 
+        Object** staticSchedule, FlowPartition* staticPartitions, uint32_t staticPartitionCount) :
+        arena(), firstObject(first), lastObject(last), index(staticIndex), indexSize(staticIndexSize), objectCount(count), indexStatic(true),
+        schedule(staticSchedule), scheduleCount(count), scheduleCapacity(count), partitions(staticPartitions), partitionCount(staticPartitionCount),
+        partitionCapacity(staticPartitionCount), scheduleStatic(true), flowScheduled(false), scheduleValid(true), batchCount(0), batchScratch(NULL), batchScratchSize(0),
+        timers(NULL), timerCount(0), timerCapacity(0), dueObjects(NULL), dueCount(0), dueCapacity(0), timersValid(false) {};
+      // an ObjectList owns its arena, index, schedule and timers, it isn't copied
+      ObjectListBase(const ObjectListBase&) = delete;
+      ObjectListBase& operator=(const ObjectListBase&) = delete;
+
+      // Objects and Resources are allocated from the arena and freed together
+      ArenaBase arena;
+
       // Linked list of Objects
       Object* firstObject; 
+      Object* lastObject; // newObject appends here
+
+      // Open addressing hash index of the Objects, maintained by newObject
+      ObjectIndexEntry* index; 
+      uint32_t indexSize; // number of slots, always a power of 2
+      uint32_t objectCount; // number of Objects in the list and in the index
+      bool indexStatic; // index is static storage and can't be deleted
+
+      // Objects in topological order of the links, built by buildSchedule and run by runFlow
+      Object** schedule;
+      uint32_t scheduleCount;
+      uint32_t scheduleCapacity; // size of the schedule array
+      FlowPartition* partitions; // the schedule grouped into parts that share no links, in list order
+      uint32_t partitionCount;
+      uint32_t partitionCapacity; // size of the partitions array
+      bool scheduleStatic; // schedule and partitions are static storage and can't be deleted
+      // default value updates mark Objects dirty for runFlow instead of calling the handler, off unless the
+      // application sets it, so updateDefaultValue and the syncs run the handlers as they always have
+      bool flowScheduled;
+      bool scheduleValid; // cleared by newObject and by link changes, runFlow builds the schedule again
+      uint32_t linkGeneration = 0; // counted by newObject, the links of Objects resolved before are resolved again
+
+      uint32_t batchCount; // number of updateValues batches, marks the Resources listed in a batch
+      char* batchScratch; // arrays of the last updateValues batch, reused by the next
+      size_t batchScratchSize;
 
-      // make a new object and add it to the list
+      /*
+      Timer heap of the Objects with CurrentTime, LastActivationTime and an IntervalTime other than 0, a min-heap 
+      by next due time, so updateTimers only visits the Objects that are due. It is built on first use, a static 
+      graph's too, and rebuilt after newResource of a timer resource. updateValueByID and updateValues of an 
+      IntervalTime or LastActivationTime reschedule the Object, a value written with Resource::setValue isn't seen. 
+      Due times are ordered by their wrap-safe difference, so pending due times must be less than half the 
+      time_t range apart, and a LastActivationTime must not be ahead of the time. Objects with IntervalTime 0 are
+      due on every call, they aren't in the heap but in dueObjects, which updateTimers runs first.
+      */
+      TimerEntry* timers;
+      uint32_t timerCount;
+      uint32_t timerCapacity; // size of the timers array
+      Object** dueObjects; // Objects with IntervalTime 0
+      uint32_t dueCount;
+      uint32_t dueCapacity; // size of the dueObjects array
+      bool timersValid; // cleared by newResource of a timer resource, updateTimers builds the heap again
+
+#ifdef OBJECTFLOW_COMPILED_FLOW
+      // set while the run method of a compiled flow from the builder's compiledFlowHeader calls the handlers, 
+      // syncToOutputLink only sets the Object's synced flag, and the generated code copies the values along the
+      // links of the Objects whose handler synced
+      bool linksCompiled = false;
+#endif
+
+#ifdef OBJECTFLOW_IMAGE
+      // mapping of the flow image loaded by loadImage, the Objects use its keys and strings until freeObjects
+      void* image = NULL;
+      uint32_t imageSize = 0;
+
+      // build the flow in a binary flow image file made by the builder, see flowimage.h. The list must be 
+      // empty. Returns the number of Objects, 0 if the image can't be loaded
+      uint32_t loadImage(const char* path);
+
+      // unmap the flow image, called by freeObjects
+      void releaseImage();
+#endif
+
+      // make a new object and add it to the list, or return the existing object with the same type and instance
       Object* newObject(uint16_t type, uint16_t instance);
+
+      // add an Object made by the caller, from the arena, e.g. of an application class that applicationObject doesn't
+      // make. Returns NULL if there is already an Object with its type and instance. With OBJECTFLOW_STATIC_DISPATCH
+      // its handlers are only called if its class is in the switch of Object::callInterval etc.
+      Object* addObject(Object* object);
       
       // return an application-specialized object based on typeID
       // The implementation for this is in handlers.cpp, code gen with applicationtypes
@@ -190,10 +616,74 @@ namespace ObjectFlow
 
       // return a pointer to the first object that matches the type and instance
       Object* getObjectByID(uint16_t type, uint16_t instance);
+
+      // add an Object to the hash index, growing the index to keep the load factor at or below 1/2
+      void indexObject(Object* object);
       
+      // free all Objects and Resources, leaving an empty object list. The arena is released without running
+      // destructors, so application Objects must be trivially destructible or free what they own before
+      void freeObjects();
+
+      // build the objects and resources in instances.h
       void buildInstances();
 
+      // build the objects and resources in a table of instance templates
+      void buildInstances(const InstanceTemplate* templates, uint32_t count);
+
+      // resolve the links of all Objects, reports dangling links and returns the number found
+      uint32_t resolveLinks();
+
+      // apply a batch of resource updates and call onValuesUpdate once for each Object updated, 
+      // returns the number of updates applied
+      uint32_t updateValues(const ValueUpdate* updates, uint32_t count);
+
+      // total of the default value updates suppressed by the Objects because the value didn't change
+      uint32_t suppressedUpdates();
+
+      // sort the Objects in link order for runFlow, reports cycles and returns the number found
+      uint32_t buildSchedule();
+
+      // mark an Object to be run by runFlow
+      void markDirty(Object* object);
+
+      // run each dirty Object once in schedule order, returns the number of Objects run
+      uint32_t runFlow();
+
+      // run the dirty Objects of one partition, returns the number of Objects run
+      uint32_t runPartition(uint32_t partition);
+
+      // build the timer heap and the due Objects from the timer resources of all Objects, returns the number of timed Objects
+      uint32_t buildTimers();
+
+      // move an Object in the timer heap after its IntervalTime or LastActivationTime changed, adding or removing it
+      void rescheduleTimer(Object* object);
+
+      // update CurrentTime and LastActivationTime and call onInterval of each Object that is due at the time, 
+      // as updateCurrentTime does, returns the number of Objects run. Objects that aren't due are not visited,
+      // Objects with IntervalTime 0 are run on every call
+      uint32_t updateTimers(time_t timeValue);
+
+      // the time the first timed Object is due, for a host loop to sleep until then, returns false if there are
+      // no timed Objects. Objects with IntervalTime 0 are due on every updateTimers call and don't set a deadline
+      bool nextDeadline(time_t* deadline);
+
       void displayObjects();
   };
 
+  class ObjectList : public ObjectListBase {
+    public:
+      // frees all Objects and Resources
+      ~ObjectList();
+  };
+
+#ifdef OBJECTFLOW_STATIC_GRAPH
+  // the statically initialized graph in static-instances.h
+  extern ObjectListBase staticObjectList;
+#endif
+
 }
+
+#include "flowpool.h"
+#include "flowimage.h"
+#include "snapshot.h"
+#include "eventloop.h"
@@ -0,0 +1,72 @@
+/* objectstats counts and times the handlers of each Object, for builds with OBJECTFLOW_STATS */
+
+#ifdef OBJECTFLOW_STATS
+#ifndef OBJECTFLOW_STATS_CLOCK
+#include <time.h>
+#endif
+
+namespace ObjectFlow
+
+{
+  /*
+  Each Object counts the calls of its handlers and the sync functions, with their total time and a histogram
+  of their times. Times include nested calls, so a syncToOutputLink includes the handlers of the Objects it
+  updates when the flow isn't scheduled. The clock is nanoseconds from CLOCK_MONOTONIC unless the target
+  defines OBJECTFLOW_STATS_CLOCK() to return its own ticks, e.g. micros(). An Object's statistics are written
+  by the thread that runs it, so other threads may read a count that is being updated.
+
+  The statistics are read as the virtual resource StatisticsType with readValueByID, all as float values.
+  The instance is statisticsInstance(handler, field): field 0 is the call count, 1 the total time, and
+  2 + n the calls that took from 4^n up to 4^(n+1) clock ticks, the last bucket has the longer calls.
+  */
+
+  enum StatisticsHandler { statInterval, statDefaultValueUpdate, statInputSync, statSyncFromInput, statSyncToOutput, statHandlerCount };
+
+  const uint16_t statisticsBuckets = 16;
+  const uint16_t statisticsFields = 2 + statisticsBuckets;
+
+  inline uint16_t statisticsInstance(uint16_t handler, uint16_t field) {
+    return handler * statisticsFields + field;
+  };
+
+  inline uint64_t statisticsClock() {
+#ifdef OBJECTFLOW_STATS_CLOCK
+    return OBJECTFLOW_STATS_CLOCK();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+#endif
+  };
+
+  struct HandlerStatistics {
+    uint32_t calls;
+    uint64_t time; // clock ticks
+    uint32_t histogram[statisticsBuckets]; // calls by log4 of their time
+
+    void record(uint64_t ticks) {
+      uint32_t bucket = (63 - __builtin_clzll(ticks | 1)) / 2;
+      calls++;
+      time += ticks;
+      histogram[bucket < statisticsBuckets ? bucket : statisticsBuckets - 1]++;
+    };
+  };
+
+  struct ObjectStatistics {
+    HandlerStatistics handler[statHandlerCount];
+  };
+
+  // times the rest of the enclosing block and records it for a handler
+  struct StatisticsScope {
+    HandlerStatistics* statistics;
+    uint64_t start;
+    StatisticsScope(HandlerStatistics* handlerStatistics) : statistics(handlerStatistics), start(statisticsClock()) {};
+    ~StatisticsScope() { statistics -> record(statisticsClock() - start); };
+  };
+}
+
+// time the rest of the block as a handler of an Object
+#define OBJECTFLOW_STATISTICS_SCOPE(object, handlerID) ObjectFlow::StatisticsScope statisticsScope(&(object) -> statistics.handler[handlerID])
+#else
+#define OBJECTFLOW_STATISTICS_SCOPE(object, handlerID)
+#endif
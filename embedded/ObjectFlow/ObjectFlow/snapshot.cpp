@@ -0,0 +1,224 @@
+/* snapshot saves the resource values of an ObjectList to a file and journal for a warm restart, for hosts built with OBJECTFLOW_SNAPSHOT */
+
+#include "objectflow.h"
+
+#ifdef OBJECTFLOW_SNAPSHOT
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+using namespace ObjectFlow;
+
+// read and check the header of a snapshot or journal file, returns false if it isn't one of this runtime
+static bool readHeader(FILE* file, uint32_t magic, FlowSnapshotHeader* header) {
+  return (1 == fread(header, sizeof(FlowSnapshotHeader), 1, file) && header -> magic == magic && header -> version == snapshotVersion
+    && header -> headerSize == sizeof(FlowSnapshotHeader) && header -> byteOrder == snapshotByteOrder);
+};
+
+// generation in the header of a file, 0 if there is none
+static uint32_t fileGeneration(const char* path, uint32_t magic) {
+  FILE* file = fopen(path, "rb");
+  if (NULL == file) {
+    return 0;
+  }
+  FlowSnapshotHeader header;
+  uint32_t generation = (readHeader(file, magic, &header) ? header.generation : 0);
+  fclose(file);
+  return generation;
+};
+
+// flush a file to the OS, and to the disk with syncWrites, returns false if it failed
+static bool flushFile(FILE* file, bool sync) {
+  return 0 == fflush(file) && (!sync || 0 == fsync(fileno(file)));
+};
+
+// exact comparison of two values of a value type, as saved
+static bool sameValue(ValueType valueType, AnyValueType first, AnyValueType second) {
+  switch (valueType) {
+    case booleanType: return first.booleanType == second.booleanType;
+    case integerType: return first.integerType == second.integerType;
+    case floatType: return 0 == memcmp(&first.floatType, &second.floatType, sizeof(double)); // a NaN is the same NaN
+    case linkType: return first.linkType.typeID == second.linkType.typeID && first.linkType.instanceID == second.linkType.instanceID;
+    case timeType: return first.timeType == second.timeType;
+    default: return true;
+  }
+};
+
+// save the values of an ObjectList to a snapshot file and a journal file, nothing is written until snapshot
+FlowSnapshot::FlowSnapshot(ObjectListBase* snapshotList, const char* snapshotFile, const char* journalFile) {
+  list = snapshotList;
+  snapshotPath = snapshotFile;
+  journalPath = journalFile;
+  temporaryPath = new char[strlen(snapshotFile) + 5];
+  strcpy(temporaryPath, snapshotFile);
+  strcat(temporaryPath, ".tmp");
+  journal = NULL;
+  generation = 0;
+  syncWrites = false;
+  resources = NULL;
+  saved = NULL;
+  pending = NULL;
+  resourceCount = 0;
+  resourceCapacity = 0;
+  bytesWritten = 0;
+  recordsWritten = 0;
+};
+
+// close the journal
+FlowSnapshot::~FlowSnapshot() {
+  if (journal != NULL) {
+    fclose(journal);
+  }
+  delete[] temporaryPath;
+  delete[] resources;
+  delete[] saved;
+  delete[] pending;
+};
+
+// list the Resources to save and copy their values
+void FlowSnapshot::collect() {
+  uint32_t count = 0;
+  for (Object* object = list -> firstObject; object != NULL; object = object -> nextObject) {
+    for (Resource* resource = object -> firstResource; resource != NULL; resource = resource -> nextResource) {
+      count += (resource -> valueType != stringType);
+    };
+  };
+  if (count > resourceCapacity || NULL == resources) {
+    delete[] resources;
+    delete[] saved;
+    delete[] pending;
+    resources = new Resource*[count + 1];
+    saved = new ValueUpdate[count + 1];
+    pending = new ValueUpdate[count + 1];
+    resourceCapacity = count;
+  }
+  resourceCount = 0;
+  for (Object* object = list -> firstObject; object != NULL; object = object -> nextObject) {
+    for (Resource* resource = object -> firstResource; resource != NULL; resource = resource -> nextResource) {
+      if (resource -> valueType != stringType) {
+        resources[resourceCount] = resource;
+        saved[resourceCount++] = (ValueUpdate){ object -> typeID, object -> instanceID, resource -> typeID, resource -> instanceID, resource -> getValue() };
+      }
+    };
+  };
+};
+
+// write all values to a new snapshot and start an empty journal, returns false if it couldn't be written
+// the snapshot replaces the old one by a rename, and only then is the journal of the old one replaced
+bool FlowSnapshot::snapshot() {
+  collect();
+  uint32_t last = fileGeneration(snapshotPath, snapshotMagic);
+  uint32_t journalLast = fileGeneration(journalPath, journalMagic);
+  uint32_t next = (last > generation ? last : generation);
+  next = (journalLast > next ? journalLast : next) + 1; // a left over journal never matches the new snapshot
+  FlowSnapshotHeader header = { snapshotMagic, snapshotVersion, sizeof(FlowSnapshotHeader), snapshotByteOrder, next, resourceCount, 0 };
+  FILE* file = fopen(temporaryPath, "wb");
+  if (NULL == file) {
+    printf("FlowSnapshot can't write %s\n", temporaryPath);
+    return false;
+  }
+  bool written = (1 == fwrite(&header, sizeof(header), 1, file) && resourceCount == fwrite(saved, sizeof(ValueUpdate), resourceCount, file)
+    && flushFile(file, syncWrites));
+  written = (0 == fclose(file) && written);
+  if (!written || rename(temporaryPath, snapshotPath) != 0) {
+    printf("FlowSnapshot can't write %s\n", snapshotPath);
+    remove(temporaryPath);
+    return false;
+  }
+  generation = next;
+  bytesWritten += sizeof(header) + (uint64_t)resourceCount * sizeof(ValueUpdate);
+  recordsWritten += resourceCount;
+
+  if (journal != NULL) {
+    fclose(journal);
+  }
+  journal = fopen(journalPath, "wb");
+  header.magic = journalMagic;
+  header.count = 0;
+  if (NULL == journal || fwrite(&header, sizeof(header), 1, journal) != 1 || !flushFile(journal, syncWrites)) {
+    printf("FlowSnapshot can't write %s\n", journalPath);
+    if (journal != NULL) {
+      fclose(journal);
+      journal = NULL;
+    }
+    return false; // the snapshot is written, journalChanges tries again with a new one
+  }
+  bytesWritten += sizeof(header);
+  return true;
+};
+
+// append the values that changed since the last snapshot or journal write, returns the number appended
+// one write per call, a record cut off by a crash is ignored by restore
+uint32_t FlowSnapshot::journalChanges() {
+  if (NULL == journal) { // no snapshot from this FlowSnapshot yet, or the journal couldn't be written
+    snapshot(); // has every value
+    return 0;
+  }
+  uint32_t count = 0;
+  for (uint32_t position = 0; position < resourceCount; position++) {
+    Resource* resource = resources[position];
+    AnyValueType value = resource -> getValue();
+    if (!sameValue(resource -> valueType, value, saved[position].value)) {
+      saved[position].value = value;
+      pending[count++] = saved[position];
+    }
+  };
+  if (0 == count) {
+    return 0;
+  }
+  if (fwrite(pending, sizeof(ValueUpdate), count, journal) != count || !flushFile(journal, syncWrites)) {
+    printf("FlowSnapshot can't write %s\n", journalPath);
+    fclose(journal);
+    journal = NULL; // the next call writes a snapshot
+    return 0;
+  }
+  bytesWritten += (uint64_t)count * sizeof(ValueUpdate);
+  recordsWritten += count;
+  return count;
+};
+
+// apply the snapshot and its journal to the list, returns the number of values applied, 0 if there is no snapshot
+// the journal is applied after the snapshot, so the last value of each resource wins
+uint32_t FlowSnapshot::restore() {
+  FILE* file = fopen(snapshotPath, "rb");
+  if (NULL == file) {
+    printf("FlowSnapshot has no snapshot %s\n", snapshotPath);
+    return 0;
+  }
+  FlowSnapshotHeader header;
+  if (!readHeader(file, snapshotMagic, &header)) {
+    printf("%s isn't a snapshot of this runtime\n", snapshotPath);
+    fclose(file);
+    return 0;
+  }
+  uint32_t snapshotCount = header.count;
+  long snapshotSize = (0 == fseek(file, 0, SEEK_END) ? ftell(file) : 0);
+  if (snapshotSize < (long)(sizeof(FlowSnapshotHeader) + (uint64_t)snapshotCount * sizeof(ValueUpdate))) {
+    printf("snapshot %s is cut off\n", snapshotPath);
+    fclose(file);
+    return 0;
+  }
+  fseek(file, sizeof(FlowSnapshotHeader), SEEK_SET);
+  uint32_t journalCount = 0;
+  FILE* journalFile = fopen(journalPath, "rb");
+  FlowSnapshotHeader journalHeader;
+  if (journalFile != NULL && readHeader(journalFile, journalMagic, &journalHeader) && journalHeader.generation == header.generation
+    && 0 == fseek(journalFile, 0, SEEK_END)) {
+    long size = ftell(journalFile);
+    journalCount = (size > (long)sizeof(FlowSnapshotHeader) ? (size - sizeof(FlowSnapshotHeader)) / sizeof(ValueUpdate) : 0); // whole records
+    fseek(journalFile, sizeof(FlowSnapshotHeader), SEEK_SET);
+  }
+  ValueUpdate* updates = new ValueUpdate[(uint64_t)snapshotCount + journalCount + 1];
+  uint32_t count = fread(updates, sizeof(ValueUpdate), snapshotCount, file);
+  fclose(file);
+  if (journalFile != NULL) {
+    count += fread(&updates[count], sizeof(ValueUpdate), journalCount, journalFile);
+    fclose(journalFile);
+  }
+  uint32_t applied = list -> updateValues(updates, count);
+  delete[] updates;
+  generation = header.generation;
+  return applied;
+};
+
+#endif
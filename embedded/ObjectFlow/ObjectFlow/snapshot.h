@@ -0,0 +1,77 @@
+/* snapshot saves the resource values of an ObjectList to a file and journal for a warm restart, for hosts built with OBJECTFLOW_SNAPSHOT */
+
+#ifdef OBJECTFLOW_SNAPSHOT
+
+namespace ObjectFlow
+
+{
+  /*
+  A FlowSnapshot keeps the state of a running flow, e.g. the integrator of a PID controller, across a restart.
+  snapshot() writes every resource value to the snapshot file and starts an empty journal, and journalChanges()
+  appends the values that changed since the last snapshot or journal write, so a call each tick writes only
+  what the flow changed. restore() applies the snapshot and then the journal to a flow built from the same
+  instances, with ObjectList::updateValues, so each Object's onValuesUpdate is called once.
+
+  Both files are a FlowSnapshotHeader followed by ValueUpdate records in host layout. A snapshot is written
+  to a temporary file and renamed, and a journal only counts with the snapshot of the same generation, so a
+  crash at any point restores either the old snapshot and its journal or the new snapshot. A record cut off
+  at the end of the journal is ignored. String values are handles into this process and are not saved. Resources added after a
+  snapshot are saved from the next one, and the FlowSnapshot must not outlive the Objects of its list.
+  */
+
+  const uint32_t snapshotMagic = 0x4E53464F; // "OFSN"
+  const uint32_t journalMagic = 0x4A4E464F; // "OFNJ"
+  const uint16_t snapshotVersion = 1;
+  const uint32_t snapshotByteOrder = 0x01020304;
+
+  struct FlowSnapshotHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize;
+    uint32_t byteOrder;
+    uint32_t generation; // a journal belongs to the snapshot of the same generation
+    uint32_t count; // records in a snapshot, a journal has records up to the end of the file
+    uint32_t reserved;
+  };
+
+  class FlowSnapshot {
+    public:
+      // save the values of an ObjectList to a snapshot file and a journal file, nothing is written until snapshot
+      FlowSnapshot(ObjectListBase* snapshotList, const char* snapshotFile, const char* journalFile);
+      // close the journal
+      ~FlowSnapshot();
+
+      ObjectListBase* list;
+      const char* snapshotPath;
+      const char* journalPath;
+      char* temporaryPath; // the snapshot is written here and renamed
+      FILE* journal; // open for appending between snapshots
+      uint32_t generation; // of the last snapshot written or restored
+      bool syncWrites; // fsync each write, for power loss as well as a process restart
+
+      // the saved Resources and the values last written for them, in list order
+      Resource** resources;
+      ValueUpdate* saved;
+      ValueUpdate* pending; // changed values of a journal write
+      uint32_t resourceCount;
+      uint32_t resourceCapacity;
+
+      // bytes and records written, for the write amplification
+      uint64_t bytesWritten;
+      uint64_t recordsWritten;
+
+      // write all values to a new snapshot and start an empty journal, returns false if it couldn't be written
+      bool snapshot();
+
+      // append the values that changed since the last snapshot or journal write, returns the number appended
+      // takes a snapshot first if there is none from this FlowSnapshot, e.g. after restore
+      uint32_t journalChanges();
+
+      // apply the snapshot and its journal to the list, returns the number of values applied, 0 if there is no snapshot
+      uint32_t restore();
+
+      // list the Resources to save and copy their values
+      void collect();
+  };
+}
+#endif
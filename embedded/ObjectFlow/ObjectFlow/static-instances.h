@@ -0,0 +1,54 @@
+// Generated by ObjectFlow builder
+// Statically initialized object graph, build with OBJECTFLOW_STATIC_GRAPH
+namespace ObjectFlow
+{
+  extern TestObject object_43000_0;
+  extern Object object_43001_0;
+  extern Object object_43002_0;
+
+  // [43000, 0]
+  Resource resources_43000_0[3] = {
+    Resource(27000, 0, linkType, AnyValueType{ .linkType = {43001,0} }, &resources_43000_0[1]),
+    Resource(27003, 0, integerType, AnyValueType{ .integerType = 0 }, &resources_43000_0[2]),
+    Resource(27001, 0, linkType, AnyValueType{ .linkType = {43002,0} }, NULL),
+  };
+  uint32_t keys_43000_0[3] = { 1769472000u, 1769668608u, 1769537536u };
+  Resource* table_43000_0[3] = { &resources_43000_0[0], &resources_43000_0[1], &resources_43000_0[2] };
+  Object* outputs_43000_0[] = { &object_43002_0 };
+  TestObject object_43000_0({ 43000, 0, &object_43001_0, &object_43000_0, &resources_43000_0[0], &resources_43000_0[2], &staticObjectList,
+    &resources_43000_0[1], &resources_43000_0[1], &object_43001_0, outputs_43000_0, 1, keys_43000_0, table_43000_0, 3, 1, 0, NULL });
+
+  // [43001, 0]
+  Resource resources_43001_0[1] = {
+    Resource(27004, 0, integerType, AnyValueType{ .integerType = 101 }, NULL),
+  };
+  uint32_t keys_43001_0[1] = { 1769734144u };
+  Resource* table_43001_0[1] = { &resources_43001_0[0] };
+  Object object_43001_0({ 43001, 0, &object_43002_0, &object_43000_0, &resources_43001_0[0], &resources_43001_0[0], &staticObjectList,
+    &resources_43001_0[0], &resources_43001_0[0], NULL, NULL, 0, keys_43001_0, table_43001_0, 1, 0, 0, NULL });
+
+  // [43002, 0]
+  Resource resources_43002_0[1] = {
+    Resource(27002, 0, integerType, AnyValueType{ .integerType = 0 }, NULL),
+  };
+  uint32_t keys_43002_0[1] = { 1769603072u };
+  Resource* table_43002_0[1] = { &resources_43002_0[0] };
+  Object object_43002_0({ 43002, 0, NULL, &object_43000_0, &resources_43002_0[0], &resources_43002_0[0], &staticObjectList,
+    &resources_43002_0[0], &resources_43002_0[0], NULL, NULL, 0, keys_43002_0, table_43002_0, 1, 2, 0, NULL });
+
+  ObjectIndexEntry staticIndex[8] = {
+    { 2818048000u, &object_43000_0 },
+    { 2818113536u, &object_43001_0 },
+    { 2818179072u, &object_43002_0 },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+  };
+
+  Object* staticSchedule[3] = { &object_43001_0, &object_43000_0, &object_43002_0 };
+  FlowPartition staticPartitions[1] = { { 0, 3, 3, 0, false } };
+
+  ObjectListBase staticObjectList(&object_43000_0, &object_43002_0, staticIndex, 8, 3, staticSchedule, staticPartitions, 1);
+}
\ No newline at end of file
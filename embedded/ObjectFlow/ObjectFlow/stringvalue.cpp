@@ -0,0 +1,86 @@
+/* stringvalue is the string value of a resource, short strings inline and longer strings interned */
+
+#include "objectflow.h"
+
+using namespace ObjectFlow;
+
+// the intern table, an open addressing hash of the interned strings, whose text is in the arena
+static ArenaBase stringArena(4096); // the interned strings last as long as the program, nothing is freed at exit
+static const char** internTable = NULL;
+static uint32_t internSize = 0; // number of slots, always a power of 2
+static uint32_t internCount = 0;
+
+// FNV-1a hash of the text, and its length
+static uint32_t stringHash(const char* text, size_t* length) {
+  uint32_t hash = 2166136261u;
+  const char* character = text;
+  for ( ; *character != 0; character++) {
+    hash = (hash ^ (uint8_t)*character) * 16777619u;
+  };
+  *length = character - text;
+  return hash;
+};
+
+// double the table and re-insert the strings
+static void growInternTable() {
+  uint32_t size = (0 == internSize ? 64 : internSize * 2);
+  const char** table = new const char*[size];
+  for (uint32_t slot = 0; slot < size; slot++) {
+    table[slot] = NULL;
+  };
+  for (uint32_t slot = 0; slot < internSize; slot++) {
+    if (internTable[slot] != NULL) {
+      size_t length;
+      uint32_t newSlot = stringHash(internTable[slot], &length) & (size - 1);
+      while (table[newSlot] != NULL) {
+        newSlot = (newSlot + 1) & (size - 1);
+      };
+      table[newSlot] = internTable[slot];
+    }
+  };
+  delete[] internTable;
+  internTable = table;
+  internSize = size;
+};
+
+// the handle of a string, inline or interned
+StringValue ObjectFlow::stringValue(const char* text) {
+  StringValue value;
+  memset(&value, 0, sizeof(value));
+  if (NULL == text || 0 == *text) {
+    return value; // the empty string
+  }
+  size_t length;
+  uint32_t hash = stringHash(text, &length);
+  if (length <= inlineStringLength) {
+    value.bytes[0] = (uint8_t)((length << 1) | 1);
+    memcpy(&value.bytes[1], text, length);
+    return value;
+  }
+  if ((internCount + 1) * 2 > internSize) {
+    growInternTable();
+  }
+  uint32_t slot = hash & (internSize - 1);
+  while (internTable[slot] != NULL) { // probe until the string or an empty slot is found
+    if (0 == strcmp(internTable[slot], text)) {
+      value.interned = internTable[slot];
+      return value;
+    }
+    slot = (slot + 1) & (internSize - 1);
+  };
+  char* copy = (char*)stringArena.allocate(length + 1); // aligned for any node, so the low bit is 0
+  if (NULL == copy) {
+    printf("intern table out of memory\n");
+    return value;
+  }
+  memcpy(copy, text, length + 1);
+  internTable[slot] = copy;
+  internCount++;
+  value.interned = copy;
+  return value;
+};
+
+// number of strings in the intern table
+uint32_t ObjectFlow::internedStrings() {
+  return internCount;
+};
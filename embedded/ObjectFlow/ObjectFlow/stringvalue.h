@@ -0,0 +1,53 @@
+/* stringvalue is the string value of a resource, short strings inline and longer strings interned */
+
+#include <string.h>
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "StringValue keeps its inline tag in the low byte of the interned pointer, which needs a little endian target"
+#endif
+
+namespace ObjectFlow
+
+{
+  /*
+  A StringValue fits in the value slot of a resource. A string of up to inlineStringLength characters is kept
+  in the slot, the first byte is (length << 1) | 1 and the text follows with a NUL. A longer string is a
+  pointer to its copy in the intern table, which is at least 2 byte aligned, so the low bit tells them apart.
+  The empty string is all zero bits. Every string has one such handle, so two strings are equal when their
+  handles are, and there is no allocation for short strings or for a string that is already interned.
+
+  Make string values with stringValue. The intern table is shared by all ObjectLists and kept for the life of
+  the program, so it suits units and labels rather than text that changes all the time, and it must only be
+  used from one thread at a time. Builder tables use stringLiteral, which buildInstances turns into a handle. A static graph keeps
+  the literal, so the first update of a string resource there always counts as a change.
+  */
+
+  const uint16_t stringValueSize = (sizeof(double) > sizeof(char*) ? sizeof(double) : sizeof(char*));
+  const uint16_t inlineStringLength = stringValueSize - 2;
+
+  union StringValue {
+    const char* interned;
+    uint8_t bytes[stringValueSize];
+
+    bool isInline() const { return bytes[0] & 1; };
+
+    // the text, a short string is in this value so the pointer is only good while the value is
+    const char* chars() const { return (isInline() ? (const char*)&bytes[1] : (NULL == interned ? "" : interned)); };
+  };
+
+  // equal strings have equal handles
+  inline bool sameString(const StringValue& first, const StringValue& second) {
+    return (first.isInline() ? 0 == memcmp(first.bytes, second.bytes, stringValueSize) : first.interned == second.interned);
+  };
+
+  // the handle of a string, inline or interned
+  StringValue stringValue(const char* text);
+
+  // a string in a builder table, only good for buildInstances, which makes the handle
+  constexpr StringValue stringLiteral(const char* text) {
+    return StringValue{ text };
+  };
+
+  // number of strings in the intern table
+  uint32_t internedStrings();
+}
@@ -0,0 +1,120 @@
+/* valuemap maps values linearly from an input range to a current range and clamps them */
+
+/*
+The batch kernels are chosen at compile time for the target as in keysearch.h: AVX2 maps 4 doubles per
+instruction, SSE2 and NEON map 2, and the scalar loop is used on other targets and for the remainder. Define
+OBJECTFLOW_SCALAR_VALUEMAP to use the scalar loop everywhere. Every kernel clamps to the minimum first and
+then to the maximum, so they give the same results, and a NaN input stays NaN.
+*/
+
+#if !defined(OBJECTFLOW_SCALAR_VALUEMAP) && defined(__AVX2__)
+#include <immintrin.h>
+#define OBJECTFLOW_VALUEMAP_KERNEL "avx2"
+#elif !defined(OBJECTFLOW_SCALAR_VALUEMAP) && defined(__SSE2__)
+#include <emmintrin.h>
+#define OBJECTFLOW_VALUEMAP_KERNEL "sse2"
+#elif !defined(OBJECTFLOW_SCALAR_VALUEMAP) && defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define OBJECTFLOW_VALUEMAP_KERNEL "neon"
+#else
+#define OBJECTFLOW_VALUEMAP_KERNEL "scalar"
+#endif
+
+/*
+ValueMap maps an integer input in a small range through a table of the mapped values where double arithmetic is
+done in software, on ARM targets without a double precision FPU. With an FPU mapValue is as fast as a table load
+and doesn't take the cache lines of a table per channel. Define OBJECTFLOW_VALUEMAP_TABLE to use tables on every target.
+*/
+#if !defined(OBJECTFLOW_VALUEMAP_TABLE) && defined(__arm__) && !(defined(__ARM_FP) && (__ARM_FP & 8))
+#define OBJECTFLOW_VALUEMAP_TABLE
+#endif
+
+namespace ObjectFlow
+
+{
+  // value * scale + offset clamped to [minimum, maximum]
+  struct LinearMap {
+    double scale;
+    double offset;
+    double minimum;
+    double maximum;
+  };
+
+  // the map through (inputLow, currentLow) and (inputHigh, currentHigh), a zero input range maps to currentLow
+  inline LinearMap linearMap(double inputLow, double inputHigh, double currentLow, double currentHigh, double minimum, double maximum) {
+    double scale = (inputHigh != inputLow ? (currentHigh - currentLow) / (inputHigh - inputLow) : 0.0);
+    return (LinearMap){ scale, currentLow - inputLow * scale, minimum, maximum };
+  };
+
+  // map one value, the reference for the batch kernels
+  inline double mapValue(const LinearMap& map, double value) {
+    double mapped = value * map.scale + map.offset;
+    mapped = (mapped < map.minimum ? map.minimum : mapped);
+    return (mapped > map.maximum ? map.maximum : mapped);
+  };
+
+  // map a batch of samples with one map
+  inline void mapValues(const LinearMap& map, const double* values, double* mapped, uint32_t count) {
+    uint32_t position = 0;
+#if !defined(OBJECTFLOW_SCALAR_VALUEMAP) && defined(__AVX2__)
+    __m256d scale4 = _mm256_set1_pd(map.scale), offset4 = _mm256_set1_pd(map.offset);
+    __m256d minimum4 = _mm256_set1_pd(map.minimum), maximum4 = _mm256_set1_pd(map.maximum);
+    for (; position + 4 <= count; position += 4) {
+      __m256d value = _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(values + position), scale4), offset4);
+      value = _mm256_max_pd(minimum4, value); // the second operand is returned for a NaN, as the scalar compare does
+      _mm256_storeu_pd(mapped + position, _mm256_min_pd(maximum4, value));
+    };
+#elif !defined(OBJECTFLOW_SCALAR_VALUEMAP) && defined(__SSE2__)
+    __m128d scale2 = _mm_set1_pd(map.scale), offset2 = _mm_set1_pd(map.offset);
+    __m128d minimum2 = _mm_set1_pd(map.minimum), maximum2 = _mm_set1_pd(map.maximum);
+    for (; position + 2 <= count; position += 2) {
+      __m128d value = _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(values + position), scale2), offset2);
+      value = _mm_max_pd(minimum2, value);
+      _mm_storeu_pd(mapped + position, _mm_min_pd(maximum2, value));
+    };
+#elif !defined(OBJECTFLOW_SCALAR_VALUEMAP) && defined(__ARM_NEON) && defined(__aarch64__)
+    float64x2_t scale2 = vdupq_n_f64(map.scale), offset2 = vdupq_n_f64(map.offset);
+    float64x2_t minimum2 = vdupq_n_f64(map.minimum), maximum2 = vdupq_n_f64(map.maximum);
+    for (; position + 2 <= count; position += 2) {
+      float64x2_t value = vaddq_f64(vmulq_f64(vld1q_f64(values + position), scale2), offset2);
+      value = vbslq_f64(vcltq_f64(value, minimum2), minimum2, value); // compares, vmaxq would drop a NaN
+      vst1q_f64(mapped + position, vbslq_f64(vcgtq_f64(value, maximum2), maximum2, value));
+    };
+#endif
+    for (; position < count; position++) {
+      mapped[position] = mapValue(map, values[position]);
+    };
+  };
+
+  // map one value of each of a batch of channels, each with its own map, the maps as arrays of their fields
+  inline void mapChannels(const double* scale, const double* offset, const double* minimum, const double* maximum,
+      const double* values, double* mapped, uint32_t count) {
+    uint32_t position = 0;
+#if !defined(OBJECTFLOW_SCALAR_VALUEMAP) && defined(__AVX2__)
+    for (; position + 4 <= count; position += 4) {
+      __m256d value = _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(values + position), _mm256_loadu_pd(scale + position)),
+        _mm256_loadu_pd(offset + position));
+      value = _mm256_max_pd(_mm256_loadu_pd(minimum + position), value);
+      _mm256_storeu_pd(mapped + position, _mm256_min_pd(_mm256_loadu_pd(maximum + position), value));
+    };
+#elif !defined(OBJECTFLOW_SCALAR_VALUEMAP) && defined(__SSE2__)
+    for (; position + 2 <= count; position += 2) {
+      __m128d value = _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(values + position), _mm_loadu_pd(scale + position)),
+        _mm_loadu_pd(offset + position));
+      value = _mm_max_pd(_mm_loadu_pd(minimum + position), value);
+      _mm_storeu_pd(mapped + position, _mm_min_pd(_mm_loadu_pd(maximum + position), value));
+    };
+#elif !defined(OBJECTFLOW_SCALAR_VALUEMAP) && defined(__ARM_NEON) && defined(__aarch64__)
+    for (; position + 2 <= count; position += 2) {
+      float64x2_t value = vaddq_f64(vmulq_f64(vld1q_f64(values + position), vld1q_f64(scale + position)), vld1q_f64(offset + position));
+      float64x2_t limit = vld1q_f64(minimum + position);
+      value = vbslq_f64(vcltq_f64(value, limit), limit, value);
+      limit = vld1q_f64(maximum + position);
+      vst1q_f64(mapped + position, vbslq_f64(vcgtq_f64(value, limit), limit, value));
+    };
+#endif
+    for (; position < count; position++) {
+      mapped[position] = mapValue((LinearMap){ scale[position], offset[position], minimum[position], maximum[position] }, values[position]);
+    };
+  };
+}